@@ -0,0 +1,404 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-consumer-rtc-conference.hpp"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+#include "ns3/object-factory.h"
+
+#include <sstream>
+
+NS_LOG_COMPONENT_DEFINE("ndn.ConsumerRtcConference");
+
+namespace ns3 {
+namespace ndn {
+
+NS_OBJECT_ENSURE_REGISTERED(ConsumerRtcConference);
+
+TypeId
+ConsumerRtcConference::GetTypeId()
+{
+  static TypeId tid =
+    TypeId("ns3::ndn::ConsumerRtcConference")
+      .SetGroupName("Ndn")
+      .SetParent<Consumer>()
+      .AddConstructor<ConsumerRtcConference>()
+
+      .AddAttribute("ConferencePrefix", "Name of the conference", StringValue("/"),
+                    MakeNameAccessor(&ConsumerRtcConference::m_conferencePrefix),
+                    MakeNameChecker())
+
+      .AddAttribute("Producers",
+                    "Space-separated prefixes of the subscribed producers (ProducerPrefix of "
+                    "their ProducerRtc apps)",
+                    StringValue(""), MakeStringAccessor(&ConsumerRtcConference::m_producers),
+                    MakeStringChecker())
+
+      .AddAttribute("SamplingRate", "Sampling Rate (frames per second)", UintegerValue(30),
+                    MakeUintegerAccessor(&ConsumerRtcConference::m_samplingRate),
+                    MakeUintegerChecker<uint32_t>(2))
+
+      .AddAttribute("SegmentsPerDeltaFrame", "Segments per delta frame", UintegerValue(5),
+                    MakeUintegerAccessor(&ConsumerRtcConference::m_segmentsPerDeltaFrame),
+                    MakeUintegerChecker<uint32_t>())
+
+      .AddAttribute("SegmentsPerKeyFrame", "Segments per key frame", UintegerValue(30),
+                    MakeUintegerAccessor(&ConsumerRtcConference::m_segmentsPerKeyFrame),
+                    MakeUintegerChecker<uint32_t>())
+
+      .AddAttribute("MaxRetransmissions", "Maximum number of retransmissions of a segment Interest",
+                    UintegerValue(3), MakeUintegerAccessor(&ConsumerRtcConference::m_maxRetx),
+                    MakeUintegerChecker<uint32_t>())
+
+      .AddAttribute("PipelineControl",
+                    "TypeId of the controller of the pipeline size (lambda) of every stream",
+                    StringValue("ns3::ndn::RtcPipelineControlEwma"),
+                    MakeStringAccessor(&ConsumerRtcConference::m_pipelineControl),
+                    MakeStringChecker())
+
+      .AddAttribute("Filename", "Name of output .csv file", StringValue("default-conference.csv"),
+                    MakeStringAccessor(&ConsumerRtcConference::m_filename), MakeStringChecker())
+
+      .AddTraceSource("FrameCompleted", "All segments of a frame received",
+                      MakeTraceSourceAccessor(&ConsumerRtcConference::m_frameCompleted),
+                      "ns3::ndn::ConsumerRtcConference::FrameCallback")
+
+      .AddTraceSource("SegmentAbandoned", "Segment given up after MaxRetransmissions",
+                      MakeTraceSourceAccessor(&ConsumerRtcConference::m_segmentAbandoned),
+                      "ns3::ndn::ConsumerRtcConference::SegmentCallback");
+
+  return tid;
+}
+
+ConsumerRtcConference::ConsumerRtcConference()
+  : m_samplingRate(30)
+  , m_segmentsPerDeltaFrame(5)
+  , m_segmentsPerKeyFrame(30)
+  , m_maxRetx(3)
+{
+  NS_LOG_FUNCTION_NOARGS();
+}
+
+void
+ConsumerRtcConference::StartApplication()
+{
+  NS_LOG_FUNCTION_NOARGS();
+  App::StartApplication();
+
+  m_outputFile.open(m_filename);
+  m_outputFile << "Time,RTT,Frame Name\n";
+
+  m_framePeriod = Seconds(1.0 / m_samplingRate);
+  ObjectFactory pipelineFactory(m_pipelineControl);
+
+  m_streams.clear();
+  m_pending.clear();
+  std::istringstream producers(m_producers);
+  std::string producer;
+  while (producers >> producer) {
+    Stream stream;
+    stream.ns = RtcNamespace(Name(m_conferencePrefix).append(Name(producer)));
+    stream.registry = RtcFrameRegistry::getRegistry(stream.ns.getStreamPrefix());
+    stream.pipeline = pipelineFactory.Create<RtcPipelineControl>();
+    stream.isBootstrapped = false;
+    stream.keyId = 0;
+    stream.deltaId = 0;
+    stream.keyForDeltas = 0;
+    stream.nInFlightFrames = 0;
+    stream.isDataFresh = true;
+    m_streams.push_back(stream);
+  }
+  NS_LOG_INFO("Subscribing to " << m_streams.size() << " streams");
+
+  for (size_t i = 0; i < m_streams.size(); i++) {
+    SendBootstrapInterest(i);
+  }
+  m_timeoutEvent =
+    Simulator::Schedule(m_retxTimer, &ConsumerRtcConference::CheckTimeouts, this);
+}
+
+void
+ConsumerRtcConference::StopApplication()
+{
+  NS_LOG_FUNCTION_NOARGS();
+
+  App::StopApplication();
+  m_timeoutEvent.Cancel();
+
+  m_outputFile.close();
+}
+
+void
+ConsumerRtcConference::ScheduleNextPacket()
+{
+  for (size_t i = 0; i < m_streams.size(); i++) {
+    if (m_streams[i].isBootstrapped) {
+      FillPipeline(i);
+    }
+  }
+}
+
+void
+ConsumerRtcConference::SendInterest(const Name& name, bool mustBeFresh)
+{
+  shared_ptr<Interest> interest = m_interestFactory.build(name, m_interestLifeTime);
+  interest->setMustBeFresh(mustBeFresh);
+
+  m_transmittedInterests(interest, this, m_face);
+  m_appLink->onReceiveInterest(*interest);
+}
+
+void
+ConsumerRtcConference::SendBootstrapInterest(size_t stream)
+{
+  const Name& name = m_streams[stream].ns.getDeltaPrefix();
+  NS_LOG_INFO("> Bootstrap Interest: " << name);
+
+  Time now = Simulator::Now();
+  m_pending[name] = PendingInterest{stream, SEGMENT_BOOTSTRAP, now, now,
+                                    m_rtt->RetransmitTimeout(), 0};
+  SendInterest(name, true);
+}
+
+void
+ConsumerRtcConference::OnBootstrapData(size_t streamId, shared_ptr<const Data> data, Time drd)
+{
+  Stream& stream = m_streams[streamId];
+  RtcName parsed = stream.ns.parse(data->getName());
+
+  if (data->getFreshnessPeriod() == ::ndn::time::milliseconds::zero()
+      || parsed.type != RTC_FRAME_DELTA || parsed.keyId == RtcName::NONE) {
+    // stale answer (or producer has not generated any delta frame yet), ask again
+    SendBootstrapInterest(streamId);
+    return;
+  }
+
+  NS_LOG_INFO("> Stream " << stream.ns.getStreamPrefix() << " bootstrapped at " << data->getName());
+  stream.isBootstrapped = true;
+  stream.pipeline->Reset(m_framePeriod, drd);
+  stream.lastFrameArrival = Simulator::Now();
+
+  stream.keyId = parsed.keyId;
+  RequestFrame(streamId, stream.ns.getKeyFrameName(stream.keyId), m_segmentsPerKeyFrame,
+               SEGMENT_KEY);
+
+  for (uint64_t i = 0; i <= parsed.deltaId; i++) {
+    RequestFrame(streamId, stream.ns.getDeltaFrameName(i, parsed.keyId), m_segmentsPerDeltaFrame,
+                 SEGMENT_PREVIOUS_DELTA);
+  }
+
+  stream.deltaId = parsed.deltaId;
+  stream.keyForDeltas = parsed.keyId;
+  FillPipeline(streamId);
+}
+
+bool
+ConsumerRtcConference::RequestFrame(size_t streamId, const Name& frameName, uint32_t nSegments,
+                                    SegmentKind kind)
+{
+  Stream& stream = m_streams[streamId];
+  if (nSegments == 0 || stream.frames.count(frameName) > 0) {
+    return false;
+  }
+  stream.frames[frameName] = FrameState{kind, nSegments, false};
+
+  NS_LOG_INFO("> Interests for frame: " << frameName);
+  Time now = Simulator::Now();
+  Time timeout = m_rtt->RetransmitTimeout();
+  for (uint32_t i = 0; i < nSegments; i++) {
+    shared_ptr<Interest> interest =
+      m_interestFactory.start(frameName).appendSequenceNumber(i).build(m_interestLifeTime);
+
+    m_pending[interest->getName()] = PendingInterest{streamId, kind, now, now, timeout, 0};
+    m_transmittedInterests(interest, this, m_face);
+    m_appLink->onReceiveInterest(*interest);
+  }
+  return true;
+}
+
+void
+ConsumerRtcConference::FillPipeline(size_t streamId)
+{
+  Stream& stream = m_streams[streamId];
+  while (stream.nInFlightFrames < stream.pipeline->GetLambda()) {
+    // the producer generates a key frame followed by SamplingRate - 1 delta frames
+    if (stream.deltaId >= m_samplingRate - 2) {
+      stream.deltaId = 0;
+      stream.keyForDeltas++;
+    }
+    else {
+      stream.deltaId++;
+    }
+
+    if (!RequestFrame(streamId, stream.ns.getDeltaFrameName(stream.deltaId, stream.keyForDeltas),
+                      m_segmentsPerDeltaFrame, SEGMENT_DELTA)) {
+      break;
+    }
+    stream.nInFlightFrames++;
+  }
+}
+
+void
+ConsumerRtcConference::OnData(shared_ptr<const Data> data)
+{
+  if (!m_active)
+    return;
+
+  App::OnData(data); // tracing inside
+  NS_LOG_FUNCTION(data->getName());
+
+  Time now = Simulator::Now();
+  auto it = m_pending.find(data->getName());
+  if (it == m_pending.end()) {
+    // Data for a bootstrap Interest has a longer name than the Interest
+    for (size_t i = 0; i < m_streams.size(); i++) {
+      const Name& bootstrapName = m_streams[i].ns.getDeltaPrefix();
+      if (!m_streams[i].isBootstrapped && bootstrapName.isPrefixOf(data->getName())) {
+        it = m_pending.find(bootstrapName);
+        break;
+      }
+    }
+    if (it == m_pending.end()) {
+      NS_LOG_DEBUG("Unexpected Data (segment abandoned or frame already received)");
+      return;
+    }
+  }
+
+  PendingInterest pending = it->second;
+  m_pending.erase(it);
+
+  if (pending.nRetx == 0) { // Karn's algorithm
+    m_rtt->Measurement(now - pending.lastSent);
+  }
+
+  if (pending.kind == SEGMENT_BOOTSTRAP) {
+    OnBootstrapData(pending.stream, data, now - pending.firstSent);
+    return;
+  }
+
+  Time drd = now - pending.firstSent;
+  m_outputFile << now.GetSeconds() << "," << drd.GetMilliSeconds() << "," << data->getName() << "\n";
+
+  Stream& stream = m_streams[pending.stream];
+  if (pending.kind == SEGMENT_DELTA) {
+    if (stream.ns.parse(data->getName()).segment == 0) {
+      // cached frames arrive in bursts, fresh ones about one frame period apart
+      stream.isDataFresh = (now - stream.lastFrameArrival).GetSeconds()
+                           >= 0.8 * m_framePeriod.GetSeconds();
+      stream.lastFrameArrival = now;
+    }
+    if (pending.nRetx == 0) {
+      stream.pipeline->OnData(drd, stream.isDataFresh, IsCongestionMarked(*data));
+    }
+  }
+
+  OnSegmentDone(data->getName(), pending, false);
+}
+
+void
+ConsumerRtcConference::OnSegmentDone(const Name& name, const PendingInterest& pending,
+                                     bool isLost)
+{
+  size_t streamId = pending.stream;
+  Stream& stream = m_streams[streamId];
+
+  Name frameName = name.getPrefix(-1);
+  auto frame = stream.frames.find(frameName);
+  if (frame == stream.frames.end()) {
+    return;
+  }
+
+  frame->second.isLost = frame->second.isLost || isLost;
+  if (--frame->second.nRemaining > 0) {
+    return;
+  }
+
+  FrameState state = frame->second;
+  stream.frames.erase(frame);
+
+  if (!state.isLost) {
+    const RtcFrameRegistry::FrameInfo* info = stream.registry->findFrame(stream.ns.parse(frameName));
+    Time latency = info != nullptr ? Simulator::Now() - info->generationTime : Time(0);
+    NS_LOG_DEBUG("Frame " << frameName << " complete, latency " << latency.As(Time::MS));
+    m_frameCompleted(frameName, latency);
+  }
+
+  if (state.kind == SEGMENT_KEY) {
+    // the next key frame is requested in advance and waits at the producer
+    stream.keyId++;
+    RequestFrame(streamId, stream.ns.getKeyFrameName(stream.keyId), m_segmentsPerKeyFrame,
+                 SEGMENT_KEY);
+  }
+  else if (state.kind == SEGMENT_DELTA) {
+    stream.nInFlightFrames--;
+    FillPipeline(streamId);
+  }
+}
+
+void
+ConsumerRtcConference::CheckTimeouts()
+{
+  Time now = Simulator::Now();
+
+  std::vector<Name> timedOut;
+  for (const auto& pending : m_pending) {
+    if (now - pending.second.lastSent >= pending.second.timeout) {
+      timedOut.push_back(pending.first);
+    }
+  }
+
+  for (const Name& name : timedOut) {
+    PendingInterest& pending = m_pending[name];
+    if (pending.kind == SEGMENT_BOOTSTRAP) {
+      NS_LOG_INFO("> Bootstrap Interest timed out: " << name);
+      size_t stream = pending.stream;
+      m_pending.erase(name);
+      SendBootstrapInterest(stream);
+      continue;
+    }
+
+    if (pending.nRetx == 0 && pending.kind == SEGMENT_DELTA) {
+      m_streams[pending.stream].pipeline->OnTimeout();
+    }
+
+    if (pending.nRetx >= m_maxRetx) {
+      NS_LOG_INFO("Abandoning segment " << name << " after " << pending.nRetx << " retransmissions");
+      PendingInterest abandoned = pending;
+      m_pending.erase(name);
+      m_segmentAbandoned(name);
+      OnSegmentDone(name, abandoned, true);
+      continue;
+    }
+
+    pending.lastSent = now;
+    pending.timeout = pending.timeout + pending.timeout;
+    pending.nRetx++;
+
+    NS_LOG_INFO("> Retransmitting Interest for segment: " << name);
+    SendInterest(name, false);
+  }
+
+  m_timeoutEvent =
+    Simulator::Schedule(m_retxTimer, &ConsumerRtcConference::CheckTimeouts, this);
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,193 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_CONSUMER_RTC_CONFERENCE_H
+#define NDN_CONSUMER_RTC_CONFERENCE_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ndn-consumer.hpp"
+#include "ns3/ndnSIM/utils/ndn-rtc-name.hpp"
+#include "ns3/ndnSIM/utils/ndn-rtc-frame-registry.hpp"
+#include "ns3/ndnSIM/utils/ndn-rtc-pipeline-control.hpp"
+
+#include <fstream>
+#include <map>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief RTC consumer that subscribes to all producers of a conference over a single app face
+ *
+ * A conference of N participants, each subscribing to all others, needs N * (N - 1) ConsumerRtc
+ * apps, each with its own face, output file, and timers.  This app instead keeps a small state
+ * per subscribed stream (producer): its position in the stream, the frames in its pipeline,
+ * and its pipeline size controller.  Outstanding segment Interests of all streams share one
+ * table, one periodic retransmission timer, one RTT estimator, and one output file.
+ *
+ * Every stream is fetched as by ConsumerRtc: after bootstrapping from the latest delta frame,
+ * the current key frame and the previously generated delta frames paired with it are
+ * requested, followed by a pipeline of lambda delta frames, where lambda is set by the
+ * RtcPipelineControl of the stream.  The next key frame is requested once the previous one is
+ * complete.  Timed out segment Interests are retransmitted up to MaxRetransmissions times.
+ *
+ * Frames are reported through the FrameCompleted trace source with their generation-to-
+ * completion latency; playout is not modeled (see ConsumerRtc and RtcPlayout for that).
+ */
+class ConsumerRtcConference : public Consumer {
+public:
+  static TypeId
+  GetTypeId();
+
+  ConsumerRtcConference();
+
+  // From App
+  virtual void
+  OnData(shared_ptr<const Data> data);
+
+  /**
+   * @brief Get number of subscribed streams
+   */
+  size_t
+  GetNStreams() const
+  {
+    return m_streams.size();
+  }
+
+  typedef void (*FrameCallback)(const Name& frame, Time latency);
+  typedef void (*SegmentCallback)(const Name& segment);
+
+protected:
+  /**
+   * @brief Refill pipelines of all streams
+   */
+  virtual void
+  ScheduleNextPacket();
+
+  // from App
+  virtual void
+  StartApplication();
+
+  virtual void
+  StopApplication();
+
+private:
+  enum SegmentKind {
+    SEGMENT_BOOTSTRAP,
+    SEGMENT_KEY,
+    SEGMENT_DELTA,
+    SEGMENT_PREVIOUS_DELTA ///< @brief delta frame generated before the stream was bootstrapped
+  };
+
+  /// @brief Outstanding segments of a requested frame
+  struct FrameState {
+    SegmentKind kind;
+    uint32_t nRemaining;
+    bool isLost; ///< @brief whether any segment has been abandoned
+  };
+
+  /// @brief State of a subscribed stream
+  struct Stream {
+    RtcNamespace ns;
+    shared_ptr<RtcFrameRegistry> registry;
+    Ptr<RtcPipelineControl> pipeline;
+
+    bool isBootstrapped;
+    uint64_t keyId;        ///< @brief last requested key frame
+    uint64_t deltaId;      ///< @brief last requested delta frame
+    uint64_t keyForDeltas; ///< @brief key frame paired with the last requested delta frame
+    uint32_t nInFlightFrames; ///< @brief delta frames in the pipeline
+    std::map<Name, FrameState> frames;
+
+    Time lastFrameArrival;
+    bool isDataFresh; ///< @brief whether the last frame arrived about one frame period after the previous one
+  };
+
+  /// @brief Outstanding Interest
+  struct PendingInterest {
+    size_t stream;
+    SegmentKind kind;
+    Time firstSent;
+    Time lastSent;
+    Time timeout; ///< @brief RTO when first sent, doubled on every retransmission
+    uint32_t nRetx;
+  };
+
+  void
+  SendInterest(const Name& name, bool mustBeFresh);
+
+  void
+  SendBootstrapInterest(size_t stream);
+
+  void
+  OnBootstrapData(size_t stream, shared_ptr<const Data> data, Time drd);
+
+  /**
+   * @brief Request all segments of frame @p frameName of @p stream
+   * @return false if the frame has no segments or has already been requested
+   */
+  bool
+  RequestFrame(size_t stream, const Name& frameName, uint32_t nSegments, SegmentKind kind);
+
+  /**
+   * @brief Request delta frames of @p stream until its pipeline is full
+   */
+  void
+  FillPipeline(size_t stream);
+
+  /**
+   * @brief Account for segment @p name that was received or abandoned
+   */
+  void
+  OnSegmentDone(const Name& name, const PendingInterest& pending, bool isLost);
+
+  /**
+   * @brief Periodically retransmit or abandon timed out Interests of all streams
+   */
+  void
+  CheckTimeouts();
+
+private:
+  Name m_conferencePrefix;
+  std::string m_producers;
+  uint32_t m_samplingRate;
+  Time m_framePeriod;
+  uint32_t m_segmentsPerDeltaFrame;
+  uint32_t m_segmentsPerKeyFrame;
+  uint32_t m_maxRetx;
+  std::string m_pipelineControl;
+
+  std::vector<Stream> m_streams;
+  std::map<Name, PendingInterest> m_pending;
+  EventId m_timeoutEvent;
+
+  std::string m_filename;
+  std::ofstream m_outputFile;
+
+  TracedCallback<const Name&, Time> m_frameCompleted;
+  TracedCallback<const Name&> m_segmentAbandoned;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_CONSUMER_RTC_CONFERENCE_H
@@ -28,6 +28,8 @@
 #include "ns3/uinteger.h"
 #include "ns3/integer.h"
 #include "ns3/double.h"
+#include "ns3/pointer.h"
+#include "ns3/object-factory.h"
 
 #include "utils/ndn-ns3-packet-tag.hpp"
 #include "utils/ndn-rtt-mean-deviation.hpp"
@@ -91,16 +93,35 @@ ConsumerRtcKeyFirst::GetTypeId(void)
                     MakeUintegerAccessor(&ConsumerRtcKeyFirst::m_num),
                     MakeUintegerChecker<uint32_t>())
 
-      .AddAttribute("RTT", "RTT (ms)", UintegerValue(0),
+      .AddAttribute("RTT", "RTT (ms) to which the bootstrap time is compared. If 0, the smallest "
+                    "observed DRD is used", UintegerValue(0),
                     MakeUintegerAccessor(&ConsumerRtcKeyFirst::m_rtt_ideal),
-                    MakeUintegerChecker<uint32_t>());
+                    MakeUintegerChecker<uint32_t>())
+
+      .AddAttribute("Playout", "Frame assembly and playout buffer model", TypeId::ATTR_GET,
+                    PointerValue(), MakePointerAccessor(&ConsumerRtcKeyFirst::m_playout),
+                    MakePointerChecker<RtcPlayout>())
+
+      .AddAttribute("PipelineControl",
+                    "TypeId of the controller of the pipeline size (lambda), e.g., "
+                    "ns3::ndn::RtcPipelineControlMinDrd.  If empty, lambda is computed from the "
+                    "mean DRD of all received segments",
+                    StringValue("ns3::ndn::RtcPipelineControlEwma"),
+                    MakeStringAccessor(&ConsumerRtcKeyFirst::SetPipelineControl,
+                                       &ConsumerRtcKeyFirst::GetPipelineControl),
+                    MakeStringChecker())
+
+      .AddTraceSource("Lambda", "Pipeline size (number of frames requested ahead)",
+                      MakeTraceSourceAccessor(&ConsumerRtcKeyFirst::m_lambda),
+                      "ns3::TracedValueCallback::Uint32");
     ;
 
   return tid;
 }
 
 ConsumerRtcKeyFirst::ConsumerRtcKeyFirst()
-  : m_DRD(0)
+  : m_playout(CreateObject<RtcPlayout>())
+  , m_DRD(0)
   , m_lambda(0)
   , m_inFlightDeltas(0)
   , m_inFlightKeys(0)
@@ -114,6 +135,7 @@ ConsumerRtcKeyFirst::ConsumerRtcKeyFirst()
   , globalSeqNum(0)
   , m_boostrapInterests(0)
   , m_initialLambda(0)
+  , m_isDataFresh(true)
 {
   NS_LOG_FUNCTION_NOARGS();
   m_seqMax = std::numeric_limits<uint32_t>::max();
@@ -123,6 +145,27 @@ ConsumerRtcKeyFirst::~ConsumerRtcKeyFirst()
 {
 }
 
+void
+ConsumerRtcKeyFirst::SetPipelineControl(const std::string& typeId)
+{
+  if (typeId.empty()) {
+    m_pipelineControl = nullptr;
+    return;
+  }
+
+  ObjectFactory factory(typeId);
+  m_pipelineControl = factory.Create<RtcPipelineControl>();
+}
+
+std::string
+ConsumerRtcKeyFirst::GetPipelineControl() const
+{
+  if (m_pipelineControl == nullptr) {
+    return "";
+  }
+  return m_pipelineControl->GetInstanceTypeId().GetName();
+}
+
 void
 ConsumerRtcKeyFirst::StartApplication()
 {
@@ -134,6 +177,9 @@ ConsumerRtcKeyFirst::StartApplication()
   m_outputFileInterarrival << "Time,Darr,Frame Name\n";
 
   m_samplePeriod = 1.0 / m_samplingRate;
+  m_namespace = RtcNamespace(m_conferencePrefix.getPrefix(-1));
+  m_playout->Start(RtcFrameRegistry::getRegistry(m_namespace.getStreamPrefix()),
+                   Seconds(m_samplePeriod));
 
   NS_LOG_FUNCTION_NOARGS();
   NS_LOG_INFO("Interests for fresh data: " << m_mustBeFresh);
@@ -150,6 +196,7 @@ ConsumerRtcKeyFirst::StopApplication()
 
   // cleanup base stuff
   App::StopApplication();
+  m_playout->Stop();
 
   m_outputFile.close();
 }
@@ -157,13 +204,9 @@ ConsumerRtcKeyFirst::StopApplication()
 void
 ConsumerRtcKeyFirst::SendInitialInterest()
 {
-  shared_ptr<Interest> interest = make_shared<Interest>();
-  interest->setNonce(m_rand->GetValue(0, std::numeric_limits<uint32_t>::max()));
-  // Name keyName = Name(m_conferencePrefix.getPrefix(-1).toUri() + "/key");
-  Name keyName = Name(m_conferencePrefix.getPrefix(-1).toUri() + "/discovery");
-  interest->setName(keyName);
-  time::milliseconds interestLifeTime(m_interestLifeTime.GetMilliSeconds());
-  interest->setInterestLifetime(interestLifeTime);
+  // Name keyName = m_namespace.getKeyPrefix();
+  const Name& keyName = m_namespace.getDiscoveryName();
+  shared_ptr<Interest> interest = m_interestFactory.build(keyName, m_interestLifeTime);
   // Set mustBeFresh selector to true if the consumer has been configured this way
   if (m_mustBeFresh > 0) {
     interest->setMustBeFresh(true);
@@ -197,25 +240,18 @@ ConsumerRtcKeyFirst::ScheduleNextDeltaFrame()
     else {
       m_currentDeltaNum++;
     }
-    shared_ptr<Name> nameToPrint = make_shared<Name>(m_exactDataName);
-    nameToPrint->appendSequenceNumber(m_currentDeltaNum);
-    nameToPrint->append("paired-key");
-    nameToPrint->appendSequenceNumber(m_currentKeyNumForDeltas);
-
-    NS_LOG_INFO("> Interests for frame: " << nameToPrint->toUri());
+    NS_LOG_INFO("> Interests for frame: " << Name(m_exactDataName)
+                                              .appendSequenceNumber(m_currentDeltaNum)
+                                              .append(RtcNamespace::PAIRED_KEY)
+                                              .appendSequenceNumber(m_currentKeyNumForDeltas));
 
     for (int j = 0; j < m_segmentsPerDeltaFrame; j++) {
-      shared_ptr<Name> nameWithSequence = make_shared<Name>(m_exactDataName);
-      nameWithSequence->appendSequenceNumber(m_currentDeltaNum);
-      nameWithSequence->append("paired-key");
-      nameWithSequence->appendSequenceNumber(m_currentKeyNumForDeltas);
-      nameWithSequence->appendSequenceNumber(j);
-
-      shared_ptr<Interest> interest = make_shared<Interest>(*nameWithSequence);
-
-      interest->setNonce(m_rand->GetValue(0, std::numeric_limits<uint32_t>::max()));
-      time::milliseconds interestLifeTime(m_interestLifeTime.GetMilliSeconds());
-      interest->setInterestLifetime(interestLifeTime);
+      shared_ptr<Interest> interest = m_interestFactory.start(m_exactDataName)
+                                        .appendSequenceNumber(m_currentDeltaNum)
+                                        .append(RtcNamespace::PAIRED_KEY)
+                                        .appendSequenceNumber(m_currentKeyNumForDeltas)
+                                        .appendSequenceNumber(j)
+                                        .build(m_interestLifeTime);
       WillSendOutInterest(globalSeqNum);
       m_allOutstandingInterests.push_back(std::make_pair(globalSeqNum, interest->getName()));
       globalSeqNum++;
@@ -241,25 +277,18 @@ ConsumerRtcKeyFirst::ScheduleSingleDeltaFrame()
   else {
       m_currentDeltaNum++;
   }
-  shared_ptr<Name> nameToPrint = make_shared<Name>(m_exactDataName);
-  nameToPrint->appendSequenceNumber(m_currentDeltaNum);
-  nameToPrint->append("paired-key");
-  nameToPrint->appendSequenceNumber(m_currentKeyNumForDeltas);
-
-  NS_LOG_INFO("> Interests for frame: " << nameToPrint->toUri());
+  NS_LOG_INFO("> Interests for frame: " << Name(m_exactDataName)
+                                            .appendSequenceNumber(m_currentDeltaNum)
+                                            .append(RtcNamespace::PAIRED_KEY)
+                                            .appendSequenceNumber(m_currentKeyNumForDeltas));
 
   for (int j = 0; j < m_segmentsPerDeltaFrame; j++) {
-    shared_ptr<Name> nameWithSequence = make_shared<Name>(m_exactDataName);
-    nameWithSequence->appendSequenceNumber(m_currentDeltaNum);
-    nameWithSequence->append("paired-key");
-    nameWithSequence->appendSequenceNumber(m_currentKeyNumForDeltas);
-    nameWithSequence->appendSequenceNumber(j);
-
-    shared_ptr<Interest> interest = make_shared<Interest>(*nameWithSequence);
-
-    interest->setNonce(m_rand->GetValue(0, std::numeric_limits<uint32_t>::max()));
-    time::milliseconds interestLifeTime(m_interestLifeTime.GetMilliSeconds());
-    interest->setInterestLifetime(interestLifeTime);
+    shared_ptr<Interest> interest = m_interestFactory.start(m_exactDataName)
+                                      .appendSequenceNumber(m_currentDeltaNum)
+                                      .append(RtcNamespace::PAIRED_KEY)
+                                      .appendSequenceNumber(m_currentKeyNumForDeltas)
+                                      .appendSequenceNumber(j)
+                                      .build(m_interestLifeTime);
     WillSendOutInterest(globalSeqNum);
     m_allOutstandingInterests.push_back(std::make_pair(globalSeqNum, interest->getName()));
     globalSeqNum++;
@@ -292,21 +321,18 @@ ConsumerRtcKeyFirst::fetchPreviouslyGeneratedDeltas()
 {
   // Retrieve previously generated Deltas
   for (int i = 0; i <= m_currentDeltaNum; i++) {
-    Name nameToPrint = m_exactDataName;
-    nameToPrint.appendSequenceNumber(i).append("paired-key").appendSequenceNumber(m_currentKeyNumForDeltas);
-    NS_LOG_INFO("> Interests for previously generated frame: " << nameToPrint);
+    NS_LOG_INFO("> Interests for previously generated frame: "
+                << Name(m_exactDataName)
+                     .appendSequenceNumber(i)
+                     .append(RtcNamespace::PAIRED_KEY)
+                     .appendSequenceNumber(m_currentKeyNumForDeltas));
     for (int j = 0; j < m_segmentsPerDeltaFrame; j++) {
-      shared_ptr<Name> nameWithSequence = make_shared<Name>(m_exactDataName);
-      nameWithSequence->appendSequenceNumber(i);
-      nameWithSequence->append("paired-key");
-      nameWithSequence->appendSequenceNumber(m_currentKeyNumForDeltas);
-      nameWithSequence->appendSequenceNumber(j);
-
-      shared_ptr<Interest> interest = make_shared<Interest>(*nameWithSequence);
-
-      interest->setNonce(m_rand->GetValue(0, std::numeric_limits<uint32_t>::max()));
-      time::milliseconds interestLifeTime(m_interestLifeTime.GetMilliSeconds());
-      interest->setInterestLifetime(interestLifeTime);
+      shared_ptr<Interest> interest = m_interestFactory.start(m_exactDataName)
+                                        .appendSequenceNumber(i)
+                                        .append(RtcNamespace::PAIRED_KEY)
+                                        .appendSequenceNumber(m_currentKeyNumForDeltas)
+                                        .appendSequenceNumber(j)
+                                        .build(m_interestLifeTime);
       WillSendOutInterest(globalSeqNum);
       m_allOutstandingInterests.push_back(std::make_pair(globalSeqNum, interest->getName()));
       globalSeqNum++;
@@ -321,19 +347,12 @@ ConsumerRtcKeyFirst::fetchPreviouslyGeneratedDeltas()
 void
 ConsumerRtcKeyFirst::fetchCurrentKeyFrame()
 {
-  shared_ptr<Name> nameWithSequence = make_shared<Name>(m_exactDataName.getPrefix(2));
-  nameWithSequence->append("key");
-  nameWithSequence->appendSequenceNumber(m_currentKeyNum);
-  NS_LOG_INFO("Fetching current key frame: " << nameWithSequence->toUri());
+  Name keyFrameName = m_namespace.getKeyFrameName(m_currentKeyNum);
+  NS_LOG_INFO("Fetching current key frame: " << keyFrameName);
   // fetch the current key frame
   for (int i = 0; i < m_segmentsPerKeyFrame; i++) {
-    Name interestName = Name(*nameWithSequence);
-    interestName.appendSequenceNumber(i);
-
-    shared_ptr<Interest> interest = make_shared<Interest>(interestName);
-    interest->setNonce(m_rand->GetValue(0, std::numeric_limits<uint32_t>::max()));
-    time::milliseconds interestLifeTime(m_interestLifeTime.GetMilliSeconds());
-    interest->setInterestLifetime(interestLifeTime);
+    shared_ptr<Interest> interest =
+      m_interestFactory.start(keyFrameName).appendSequenceNumber(i).build(m_interestLifeTime);
     WillSendOutInterest(globalSeqNum);
     m_allOutstandingInterests.push_back(std::make_pair(globalSeqNum, interest->getName()));
     globalSeqNum++;
@@ -346,6 +365,30 @@ ConsumerRtcKeyFirst::fetchCurrentKeyFrame()
   m_currentKeyNum++;
 }
 
+void
+ConsumerRtcKeyFirst::UpdateLambda(shared_ptr<const Data> data, Time drd, bool isFresh)
+{
+  if (m_minDrd.IsZero() || drd < m_minDrd) {
+    m_minDrd = drd;
+  }
+
+  if (m_pipelineControl != nullptr) {
+    m_pipelineControl->OnData(drd, isFresh, IsCongestionMarked(*data));
+    m_lambda = m_pipelineControl->GetLambda();
+  }
+  else {
+    uint32_t lambda = ceil(m_DRD.GetSeconds() / m_samplePeriod);
+    if (lambda > m_lambda && IsCongestionMarked(*data)) {
+      NS_LOG_DEBUG("Congestion mark on " << data->getName() << ", keeping lambda at " << m_lambda);
+      return;
+    }
+    m_lambda = lambda;
+  }
+
+  if (m_printLambda)
+    std::cerr << "Lambda: " << m_lambda << std::endl;
+}
+
 bool
 ConsumerRtcKeyFirst::lastSegmentOfFrame(std::vector<std::pair<Name, Time>>::iterator it)
 {
@@ -359,12 +402,14 @@ ConsumerRtcKeyFirst::lastSegmentOfFrame(std::vector<std::pair<Name, Time>>::iter
   }
   auto element_before = it;
   auto element_after = it;
+  RtcName current = m_namespace.parse(it->first);
   // segment at the beginning of the pipeline
   if (it == m_outstandingDeltas.begin()) {
     element_after++;
-    if (element_after->first.at(2).toUri() == "delta" && element_after->first.at(5) != it->first.at(5))
+    RtcName after = m_namespace.parse(element_after->first);
+    if (after.type == RTC_FRAME_DELTA && after.keyId != current.keyId)
       return true;
-    else if (element_after->first.at(2).toUri() == "delta" && element_after->first.at(3) != it->first.at(3))
+    else if (after.type == RTC_FRAME_DELTA && after.deltaId != current.deltaId)
       return true;
     else
       return false;
@@ -372,9 +417,10 @@ ConsumerRtcKeyFirst::lastSegmentOfFrame(std::vector<std::pair<Name, Time>>::iter
   // segment at the end of the pipeline
   else if (it == m_outstandingDeltas.end() - 1) {
     element_before--;
-    if (element_before->first.at(2).toUri() == "delta" && element_before->first.at(5) != it->first.at(5))
+    RtcName before = m_namespace.parse(element_before->first);
+    if (before.type == RTC_FRAME_DELTA && before.keyId != current.keyId)
       return true;
-    else if (element_before->first.at(2).toUri() == "delta" && element_before->first.at(3) != it->first.at(3))
+    else if (before.type == RTC_FRAME_DELTA && before.deltaId != current.deltaId)
       return true;
     else
       return false;
@@ -383,9 +429,11 @@ ConsumerRtcKeyFirst::lastSegmentOfFrame(std::vector<std::pair<Name, Time>>::iter
   else {
     element_before--;
     element_after++;
-    if ((element_before->first.at(2).toUri() == "delta" && element_before->first.at(5) != it->first.at(5)) && (element_after->first.at(5).toUri() == "delta" && element_after->first.at(5) != it->first.at(5)))
+    RtcName before = m_namespace.parse(element_before->first);
+    RtcName after = m_namespace.parse(element_after->first);
+    if ((before.type == RTC_FRAME_DELTA && before.keyId != current.keyId) && (after.type == RTC_FRAME_DELTA && after.keyId != current.keyId))
       return true;
-    else if ((element_before->first.at(2).toUri() == "delta" && element_before->first.at(3) != it->first.at(3)) && (element_after->first.at(2).toUri() == "delta" && element_after->first.at(3) != it->first.at(3)))
+    else if ((before.type == RTC_FRAME_DELTA && before.deltaId != current.deltaId) && (after.type == RTC_FRAME_DELTA && after.deltaId != current.deltaId))
       return true;
     else
       return false;
@@ -459,7 +507,8 @@ ConsumerRtcKeyFirst::DeltaFrameSegmentReceived(shared_ptr<const Data> data)
     bootstrapDone = bootstrapDone - m_firstInterestSent;
     std::cerr << "Consumer " << m_num << " :Initial lambda: " << m_initialLambda << "\n";
     std::cerr << "Consumer " << m_num << " :Bootstrap time (total): " << bootstrapDone.GetMilliSeconds() << " ms\n";
-    std::cerr << "Consumer " << m_num << " :Bootstrap time: " << (1.0 * bootstrapDone.GetMilliSeconds()) / m_rtt_ideal << " xRTT" << std::endl;
+    Time rtt = m_rtt_ideal != 0 ? MilliSeconds(m_rtt_ideal) : m_minDrd;
+    std::cerr << "Consumer " << m_num << " :Bootstrap time: " << bootstrapDone.GetSeconds() / rtt.GetSeconds() << " xRTT" << std::endl;
   }
   for (auto it = m_outstandingDeltas.begin(); it != m_outstandingDeltas.end(); it++) {
     if (it->first == data->getName()) {
@@ -485,9 +534,7 @@ ConsumerRtcKeyFirst::DeltaFrameSegmentReceived(shared_ptr<const Data> data)
         m_outputFileInterarrival << Simulator::Now().GetSeconds() <<  "," << interArrivalDelay.GetMilliSeconds() << "," << data->getName() << "\n";
         m_outputFileInterarrival.flush();
       }
-      m_lambda = ceil(m_DRD.GetSeconds() / m_samplePeriod);
-      if (m_printLambda)
-        std::cerr << "Lambda: " << m_lambda << std::endl;
+      UpdateLambda(data, roundtrip, m_isDataFresh);
       break;
     }
   }
@@ -498,13 +545,15 @@ ConsumerRtcKeyFirst::OnData(shared_ptr<const Data> data)
 {
   NS_LOG_FUNCTION_NOARGS();
   uint32_t seq = -1;
+  RtcName parsed = m_namespace.parse(data->getName());
+  m_playout->OnSegment(parsed);
 
   for (auto it = m_allOutstandingInterests.begin(); it != m_allOutstandingInterests.end(); it++) {
-    if (it->second.toUri() == data->getName().toUri()) {
+    if (it->second == data->getName()) {
       seq = it->first;
       break;
     }
-    if (data->getName().at(2).toUri() == "discovery" && it->second.at(2).toUri() == "discovery") {
+    if (parsed.type == RTC_FRAME_DISCOVERY && m_namespace.getFrameType(it->second) == RTC_FRAME_DISCOVERY) {
       seq = it->first;
       NS_LOG_INFO("> Discovery Interest Timeout cancelled ");
       break;
@@ -540,12 +589,17 @@ ConsumerRtcKeyFirst::OnData(shared_ptr<const Data> data)
     m_outputFileInterarrival.flush();
 
     m_lambda = ceil(m_DRD.GetSeconds() / m_samplePeriod);
+    if (m_pipelineControl != nullptr) {
+      m_pipelineControl->Reset(Seconds(m_samplePeriod), m_DRD);
+      m_lambda = m_pipelineControl->GetLambda();
+    }
+    m_minDrd = m_DRD;
     m_initialLambda = m_lambda;
     NS_LOG_INFO("> Initial Data packet received for: " << data->getName());
-    m_exactDataName = Name(data->getName().getPrefix(-3).toUri() + "/delta") ;
+    m_exactDataName = m_namespace.getDeltaPrefix();
     // extract latest sequence number
-    uint64_t currentDeltaNum = data->getName().at(-1).toSequenceNumber();
-    uint64_t currentKeyNum = data->getName().at(-2).toSequenceNumber();
+    uint64_t currentDeltaNum = parsed.deltaId;
+    uint64_t currentKeyNum = parsed.keyId;
     if (m_currentDeltaNum <= currentDeltaNum && m_currentKeyNum <= currentKeyNum) { // && m_startTime.GetSeconds() > 1.5) {
       m_currentDeltaNum = 0;
       m_currentKeyNum = currentKeyNum + 1;
@@ -581,10 +635,10 @@ ConsumerRtcKeyFirst::OnData(shared_ptr<const Data> data)
   else {
     NS_LOG_INFO("Bootstrap done");
     // key frame segment received
-    if (data->getName().at(2).toUri() == "key") {
+    if (parsed.type == RTC_FRAME_KEY) {
       KeyFrameSegmentReceived(data);
       NS_LOG_INFO("Key Received");
-      if (m_initialKeyFrameId == data->getName().at(3).toSequenceNumber() && !m_initialKeySegmentReceived) {
+      if (m_initialKeyFrameId == parsed.keyId && !m_initialKeySegmentReceived) {
         this->ScheduleNextPacket();
         //Simulator::Schedule(Seconds(m_samplePeriod), &ConsumerRtcKeyFirst::ScheduleNextDeltaFrame, this);
         m_initialKeySegmentReceived = true;
@@ -617,11 +671,15 @@ ConsumerRtcKeyFirst::OnTimeout(uint32_t sequenceNumber)
 {
   for (auto it = m_allOutstandingInterests.begin(); it != m_allOutstandingInterests.end(); it++) {
     if (it->first == sequenceNumber) {
+      if (m_pipelineControl != nullptr) {
+        m_pipelineControl->OnTimeout();
+        m_lambda = m_pipelineControl->GetLambda();
+      }
 
       m_rtt->IncreaseMultiplier(); // Double the next RTO
       m_rtt->SentSeq(SequenceNumber32(sequenceNumber),
                  1); // make sure to disable RTT calculation for this sample
-      m_retxSeqs.insert(sequenceNumber);
+      m_seqs.scheduleRetx(sequenceNumber);
 
       NS_LOG_INFO("Timeout for name: " << it->second.toUri());
       this->SendPacketAgain(it->second, sequenceNumber);
@@ -633,10 +691,7 @@ ConsumerRtcKeyFirst::OnTimeout(uint32_t sequenceNumber)
 void
 ConsumerRtcKeyFirst::SendPacketAgain(Name interestName, uint32_t sequenceNumber)
 {
-  shared_ptr<Interest> interest = make_shared<Interest>(interestName);
-  interest->setNonce(m_rand->GetValue(0, std::numeric_limits<uint32_t>::max()));
-  time::milliseconds interestLifeTime(m_interestLifeTime.GetMilliSeconds());
-  interest->setInterestLifetime(interestLifeTime);
+  shared_ptr<Interest> interest = m_interestFactory.build(interestName, m_interestLifeTime);
   WillSendOutInterest(sequenceNumber);
   m_transmittedInterests(interest, this, m_face);
   m_appLink->onReceiveInterest(*interest);
@@ -649,7 +704,8 @@ ConsumerRtcKeyFirst::CheckIfDataFresh()
   Time interArrivalDelay = Simulator::Now() - m_previousDataArrival;
   m_previousDataArrival = Simulator::Now();
   NS_LOG_INFO("Inter arrival delay: " << interArrivalDelay.GetSeconds());
-  if (interArrivalDelay.GetSeconds() >= (80 * m_samplePeriod / 100))
+  m_isDataFresh = interArrivalDelay.GetSeconds() >= (80 * m_samplePeriod / 100);
+  if (m_isDataFresh)
     NS_LOG_INFO("Catching up with the producer...");
   else
     NS_LOG_INFO("Probably received cached data...");
@@ -660,24 +716,18 @@ ConsumerRtcKeyFirst::CheckIfDataFresh()
 void
 ConsumerRtcKeyFirst::CancelTimers(uint32_t seq, uint32_t hopCount)
 {
-  SeqTimeoutsContainer::iterator entry = m_seqLastDelay.find(seq);
-  if (entry != m_seqLastDelay.end()) {
-    m_lastRetransmittedInterestDataDelay(this, seq, Simulator::Now() - entry->time, hopCount);
-  }
-
-  entry = m_seqFullDelay.find(seq);
-  if (entry != m_seqFullDelay.end()) {
-    m_firstInterestDataDelay(this, seq, Simulator::Now() - entry->time, m_seqRetxCounts[seq], hopCount);
+  SeqStateTable::Entry* entry = m_seqs.find(seq);
+  if (entry != nullptr) {
+    SeqStateTable::Entry state = *entry;
+    m_seqs.erase(seq);
+
+    m_lastRetransmittedInterestDataDelay(this, seq, Simulator::Now() - state.lastSent, hopCount);
+    m_firstInterestDataDelay(this, seq, Simulator::Now() - state.firstSent, state.retxCount,
+                             hopCount);
   }
 
-  m_seqRetxCounts.erase(seq);
-  m_seqFullDelay.erase(seq);
-  m_seqLastDelay.erase(seq);
-
-  m_seqTimeouts.erase(seq);
-  m_retxSeqs.erase(seq);
-
   m_rtt->AckSeq(SequenceNumber32(seq));
+  ScheduleRetxTimeout();
 }
 
 } // namespace ndn
@@ -23,6 +23,10 @@
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 
 #include "ndn-consumer.hpp"
+#include "ns3/ndnSIM/utils/ndn-rtc-name.hpp"
+#include "ns3/ndnSIM/utils/ndn-rtc-playout.hpp"
+#include "ns3/ndnSIM/utils/ndn-rtc-pipeline-control.hpp"
+#include "ns3/traced-value.h"
 
 #include <fstream>
 
@@ -112,6 +116,24 @@ private:
   bool
   lastSegmentOfFrame(std::vector<std::pair<Name, Time>>::iterator it);
 
+  /**
+   * @brief Update pipeline size (lambda) after segment @p data is received with DRD @p drd
+   *
+   * If @p data carries a congestion mark, lambda is not allowed to grow: a larger DRD caused
+   * by queuing would otherwise increase the number of outstanding Interests and make the
+   * queue grow further.
+   *
+   * @param isFresh false if @p data was cached or generated before it was requested
+   */
+  void
+  UpdateLambda(shared_ptr<const Data> data, Time drd, bool isFresh);
+
+  void
+  SetPipelineControl(const std::string& typeId);
+
+  std::string
+  GetPipelineControl() const;
+
   void
   ScheduleSingleDeltaFrame();
 
@@ -131,9 +153,13 @@ protected:
   std::string m_randomType;
   uint32_t m_mustBeFresh;
   Name m_conferencePrefix;
+  RtcNamespace m_namespace; ///< @brief names of the stream, derived from m_conferencePrefix
+  Ptr<RtcPlayout> m_playout;
 
   Time m_DRD;
-  uint32_t m_lambda;
+  TracedValue<uint32_t> m_lambda;
+  Ptr<RtcPipelineControl> m_pipelineControl; ///< @brief lambda controller, if any
+  Time m_minDrd; ///< @brief smallest observed DRD
   uint32_t m_inFlightDeltas;
   uint32_t m_inFlightKeys;
 
@@ -184,6 +210,7 @@ protected:
   uint32_t m_num;
   uint32_t m_initialLambda;
   uint32_t m_rtt_ideal;
+  bool m_isDataFresh; ///< @brief whether the last frame arrived about one frame period after the previous one
 };
 
 } // namespace ndn
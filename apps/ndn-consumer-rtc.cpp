@@ -28,6 +28,11 @@
 #include "ns3/uinteger.h"
 #include "ns3/integer.h"
 #include "ns3/double.h"
+#include "ns3/pointer.h"
+#include "ns3/object-factory.h"
+
+#include <algorithm>
+#include <cmath>
 
 NS_LOG_COMPONENT_DEFINE("ndn.ConsumerRtc");
 
@@ -80,14 +85,85 @@ ConsumerRtc::GetTypeId(void)
 
       .AddAttribute("StartFromNextKeyFrame", "Option to start bootstraping with the next key frame", BooleanValue(false),
                     MakeBooleanAccessor(&ConsumerRtc::m_startFromNextKeyFrame),
-                    MakeBooleanChecker());
+                    MakeBooleanChecker())
+
+      .AddAttribute("Playout", "Frame assembly and playout buffer model", TypeId::ATTR_GET,
+                    PointerValue(), MakePointerAccessor(&ConsumerRtc::m_playout),
+                    MakePointerChecker<RtcPlayout>())
+
+      .AddAttribute("MaxRetransmissions", "Maximum number of retransmissions of a segment Interest",
+                    UintegerValue(3), MakeUintegerAccessor(&ConsumerRtc::m_maxRetx),
+                    MakeUintegerChecker<uint32_t>())
+
+      .AddAttribute("FecRatio",
+                    "Number of FEC parity segments per frame published by the producer, "
+                    "relative to the number of data segments. If 0, parity is not requested",
+                    DoubleValue(0), MakeDoubleAccessor(&ConsumerRtc::m_fecRatio),
+                    MakeDoubleChecker<double>(0))
+
+      .AddAttribute("AdaptiveFec", "Request only as many parity segments as observed loss requires",
+                    BooleanValue(false), MakeBooleanAccessor(&ConsumerRtc::m_isAdaptiveFec),
+                    MakeBooleanChecker())
+
+      .AddAttribute("BundleSegments",
+                    "Request every frame with a single Interest for the bundle of all its "
+                    "segments (requires BundleSegments of the producer)",
+                    BooleanValue(false), MakeBooleanAccessor(&ConsumerRtc::m_bundleSegments),
+                    MakeBooleanChecker())
+
+      .AddAttribute("PipelineControl",
+                    "TypeId of the controller of the pipeline size (lambda), e.g., "
+                    "ns3::ndn::RtcPipelineControlMinDrd.  If empty, lambda is computed from the "
+                    "mean DRD of all received segments",
+                    StringValue("ns3::ndn::RtcPipelineControlEwma"),
+                    MakeStringAccessor(&ConsumerRtc::SetPipelineControl,
+                                       &ConsumerRtc::GetPipelineControl),
+                    MakeStringChecker())
+
+      .AddAttribute("NumLayers", "Number of SVC layers published by the producer",
+                    UintegerValue(1), MakeUintegerAccessor(&ConsumerRtc::m_maxLayers),
+                    MakeUintegerChecker<uint32_t>(1))
+
+      .AddAttribute("EnhancementSegmentsRatio",
+                    "Number of segments of each enhancement layer published by the producer, "
+                    "relative to the number of segments of the base layer",
+                    DoubleValue(1.0), MakeDoubleAccessor(&ConsumerRtc::m_enhancementSegmentsRatio),
+                    MakeDoubleChecker<double>(0))
+
+      .AddAttribute("AdaptLayers",
+                    "Adapt the number of requested layers to throughput and queuing delay.  If "
+                    "false, all NumLayers layers are requested",
+                    BooleanValue(true), MakeBooleanAccessor(&ConsumerRtc::m_isAdaptiveLayers),
+                    MakeBooleanChecker())
+
+      .AddAttribute("AdaptationPeriod", "Interval between layer adaptation decisions",
+                    TimeValue(Seconds(1)), MakeTimeAccessor(&ConsumerRtc::m_adaptationPeriod),
+                    MakeTimeChecker())
+
+      .AddAttribute("QueuingDelayThreshold",
+                    "Queuing delay (smoothed RTT above minimum RTT) above which a layer is dropped",
+                    TimeValue(MilliSeconds(50)),
+                    MakeTimeAccessor(&ConsumerRtc::m_queuingDelayThreshold), MakeTimeChecker())
+
+      .AddTraceSource("Layers", "Number of requested SVC layers",
+                      MakeTraceSourceAccessor(&ConsumerRtc::m_nLayers),
+                      "ns3::TracedValueCallback::Uint32")
+
+      .AddTraceSource("Lambda", "Pipeline size (number of frames requested ahead)",
+                      MakeTraceSourceAccessor(&ConsumerRtc::m_lambda),
+                      "ns3::TracedValueCallback::Uint32")
+
+      .AddTraceSource("SegmentAbandoned", "Segment given up, as it cannot arrive in time",
+                      MakeTraceSourceAccessor(&ConsumerRtc::m_segmentAbandoned),
+                      "ns3::ndn::ConsumerRtc::SegmentCallback");
     ;
 
   return tid;
 }
 
 ConsumerRtc::ConsumerRtc()
-  : m_DRD(0)
+  : m_playout(CreateObject<RtcPlayout>())
+  , m_DRD(0)
   , m_lambda(0)
   , m_inFlightDeltas(0)
   , m_inFlightKeys(0)
@@ -97,6 +173,13 @@ ConsumerRtc::ConsumerRtc()
   , m_segmentsReceived(0)
   , m_bootstrap_done(false)
   , m_inFlightFrames(0)
+  , m_lossRate(0)
+  , m_nLayers(1)
+  , m_minRtt(Time::Max())
+  , m_segmentsReceivedAtAdaptation(0)
+  , m_nCongestionEvents(0)
+  , m_nPeriodsSinceDecrease(0)
+  , m_isDataFresh(true)
 {
   NS_LOG_FUNCTION_NOARGS();
   m_seqMax = std::numeric_limits<uint32_t>::max();
@@ -106,6 +189,27 @@ ConsumerRtc::~ConsumerRtc()
 {
 }
 
+void
+ConsumerRtc::SetPipelineControl(const std::string& typeId)
+{
+  if (typeId.empty()) {
+    m_pipelineControl = nullptr;
+    return;
+  }
+
+  ObjectFactory factory(typeId);
+  m_pipelineControl = factory.Create<RtcPipelineControl>();
+}
+
+std::string
+ConsumerRtc::GetPipelineControl() const
+{
+  if (m_pipelineControl == nullptr) {
+    return "";
+  }
+  return m_pipelineControl->GetInstanceTypeId().GetName();
+}
+
 void
 ConsumerRtc::StartApplication()
 {
@@ -116,6 +220,9 @@ ConsumerRtc::StartApplication()
   m_outputFileInterarrival << "Time,Darr,Frame Name\n";
 
   m_samplePeriod = 1.0 / m_samplingRate;
+  m_namespace = RtcNamespace(m_conferencePrefix.getPrefix(-1));
+  m_playout->Start(RtcFrameRegistry::getRegistry(m_namespace.getStreamPrefix()),
+                   Seconds(m_samplePeriod));
 
   NS_LOG_FUNCTION_NOARGS();
   NS_LOG_INFO("Interests for fresh data: " << m_mustBeFresh);
@@ -123,6 +230,14 @@ ConsumerRtc::StartApplication()
   // do base stuff
   App::StartApplication();
   Simulator::Schedule(Seconds(0), &ConsumerRtc::SendInitialInterest, this);
+  m_segmentTimeoutEvent =
+    Simulator::Schedule(m_retxTimer, &ConsumerRtc::CheckSegmentTimeouts, this);
+
+  m_nLayers = m_isAdaptiveLayers ? 1 : m_maxLayers;
+  if (m_isAdaptiveLayers && m_maxLayers > 1) {
+    m_adaptationEvent =
+      Simulator::Schedule(m_adaptationPeriod, &ConsumerRtc::AdaptLayers, this);
+  }
 }
 
 void
@@ -132,6 +247,9 @@ ConsumerRtc::StopApplication()
 
   // cleanup base stuff
   App::StopApplication();
+  m_playout->Stop();
+  m_segmentTimeoutEvent.Cancel();
+  m_adaptationEvent.Cancel();
 
   m_outputFile.close();
 }
@@ -139,11 +257,7 @@ ConsumerRtc::StopApplication()
 void
 ConsumerRtc::SendInitialInterest()
 {
-  shared_ptr<Interest> interest = make_shared<Interest>();
-  interest->setNonce(m_rand->GetValue(0, std::numeric_limits<uint32_t>::max()));
-  interest->setName(m_conferencePrefix);
-  time::milliseconds interestLifeTime(m_interestLifeTime.GetMilliSeconds());
-  interest->setInterestLifetime(interestLifeTime);
+  shared_ptr<Interest> interest = m_interestFactory.build(m_conferencePrefix, m_interestLifeTime);
   // Set mustBeFresh selector to true if the consumer has been configured this way
   // if (m_mustBeFresh > 0) {
   interest->setMustBeFresh(true);
@@ -174,31 +288,38 @@ ConsumerRtc::ScheduleNextDeltaFrame()
     else {
       m_currentDeltaNum++;
     }
-    shared_ptr<Name> nameToPrint = make_shared<Name>(m_exactDataName);
-    nameToPrint->appendSequenceNumber(m_currentDeltaNum);
-    nameToPrint->append("paired-key");
-    nameToPrint->appendSequenceNumber(m_currentKeyNumForDeltas);
-
-    NS_LOG_INFO("> Interests for frame: " << nameToPrint->toUri());
+    NS_LOG_INFO("> Interests for frame: " << Name(m_exactDataName)
+                                              .appendSequenceNumber(m_currentDeltaNum)
+                                              .append(RtcNamespace::PAIRED_KEY)
+                                              .appendSequenceNumber(m_currentKeyNumForDeltas));
+
+    if (m_bundleSegments) {
+      SendBundleInterest(m_namespace.getDeltaFrameName(m_currentDeltaNum, m_currentKeyNumForDeltas),
+                         m_outstandingDeltas);
+      SendLayerInterests(m_namespace.getDeltaFrameName(m_currentDeltaNum, m_currentKeyNumForDeltas),
+                         m_segmentsPerDeltaFrame, m_outstandingDeltas);
+      m_inFlightDeltas++;
+      continue;
+    }
 
     for (int j = 0; j < m_segmentsPerDeltaFrame; j++) {
-      shared_ptr<Name> nameWithSequence = make_shared<Name>(m_exactDataName);
-      nameWithSequence->appendSequenceNumber(m_currentDeltaNum);
-      nameWithSequence->append("paired-key");
-      nameWithSequence->appendSequenceNumber(m_currentKeyNumForDeltas);
-      nameWithSequence->appendSequenceNumber(j);
-
-      shared_ptr<Interest> interest = make_shared<Interest>(*nameWithSequence);
-
-      interest->setNonce(m_rand->GetValue(0, std::numeric_limits<uint32_t>::max()));
-      time::milliseconds interestLifeTime(m_interestLifeTime.GetMilliSeconds());
-      interest->setInterestLifetime(interestLifeTime);
+      shared_ptr<Interest> interest = m_interestFactory.start(m_exactDataName)
+                                        .appendSequenceNumber(m_currentDeltaNum)
+                                        .append(RtcNamespace::PAIRED_KEY)
+                                        .appendSequenceNumber(m_currentKeyNumForDeltas)
+                                        .appendSequenceNumber(j)
+                                        .build(m_interestLifeTime);
 
       m_transmittedInterests(interest, this, m_face);
       m_appLink->onReceiveInterest(*interest);
       m_outstandingDeltas.push_back(std::make_pair(interest->getName(), Simulator::Now()));
+      TrackSegment(interest->getName());
       m_inFlightDeltas++;
     }
+    SendParityInterests(m_namespace.getDeltaFrameName(m_currentDeltaNum, m_currentKeyNumForDeltas),
+                        m_segmentsPerDeltaFrame, m_outstandingDeltas);
+    SendLayerInterests(m_namespace.getDeltaFrameName(m_currentDeltaNum, m_currentKeyNumForDeltas),
+                       m_segmentsPerDeltaFrame, m_outstandingDeltas);
   }
   m_inFlightFrames += i;
 }
@@ -214,56 +335,88 @@ ConsumerRtc::fetchPreviouslyGeneratedDeltas()
 {
   // Retrieve previously generated Deltas
   for (int i = 0; i <= m_currentDeltaNum; i++) {
-    Name nameToPrint = m_exactDataName;
-    nameToPrint.appendSequenceNumber(i).append("paired-key").appendSequenceNumber(m_currentKeyNumForDeltas);
-    NS_LOG_INFO("> Interests for previously generated frame: " << nameToPrint);
+    NS_LOG_INFO("> Interests for previously generated frame: "
+                << Name(m_exactDataName)
+                     .appendSequenceNumber(i)
+                     .append(RtcNamespace::PAIRED_KEY)
+                     .appendSequenceNumber(m_currentKeyNumForDeltas));
+    if (m_bundleSegments) {
+      SendBundleInterest(m_namespace.getDeltaFrameName(i, m_currentKeyNumForDeltas),
+                         m_outstandingPreviousDeltas);
+      SendLayerInterests(m_namespace.getDeltaFrameName(i, m_currentKeyNumForDeltas),
+                         m_segmentsPerDeltaFrame, m_outstandingPreviousDeltas);
+      m_inFlightDeltas++;
+      continue;
+    }
     for (int j = 0; j < m_segmentsPerDeltaFrame; j++) {
-      shared_ptr<Name> nameWithSequence = make_shared<Name>(m_exactDataName);
-      nameWithSequence->appendSequenceNumber(i);
-      nameWithSequence->append("paired-key");
-      nameWithSequence->appendSequenceNumber(m_currentKeyNumForDeltas);
-      nameWithSequence->appendSequenceNumber(j);
-
-      shared_ptr<Interest> interest = make_shared<Interest>(*nameWithSequence);
-
-      interest->setNonce(m_rand->GetValue(0, std::numeric_limits<uint32_t>::max()));
-      time::milliseconds interestLifeTime(m_interestLifeTime.GetMilliSeconds());
-      interest->setInterestLifetime(interestLifeTime);
+      shared_ptr<Interest> interest = m_interestFactory.start(m_exactDataName)
+                                        .appendSequenceNumber(i)
+                                        .append(RtcNamespace::PAIRED_KEY)
+                                        .appendSequenceNumber(m_currentKeyNumForDeltas)
+                                        .appendSequenceNumber(j)
+                                        .build(m_interestLifeTime);
 
       m_transmittedInterests(interest, this, m_face);
       m_appLink->onReceiveInterest(*interest);
       m_outstandingPreviousDeltas.push_back(std::make_pair(interest->getName(), Simulator::Now()));
+      TrackSegment(interest->getName());
       m_inFlightDeltas++;
     }
+    SendParityInterests(m_namespace.getDeltaFrameName(i, m_currentKeyNumForDeltas),
+                        m_segmentsPerDeltaFrame, m_outstandingPreviousDeltas);
+    SendLayerInterests(m_namespace.getDeltaFrameName(i, m_currentKeyNumForDeltas),
+                       m_segmentsPerDeltaFrame, m_outstandingPreviousDeltas);
   }
 }
 
 void
 ConsumerRtc::fetchCurrentKeyFrame()
 {
-  shared_ptr<Name> nameWithSequence = make_shared<Name>(m_exactDataName.getPrefix(2));
-  nameWithSequence->append("key");
-  nameWithSequence->appendSequenceNumber(m_currentKeyNum);
-  NS_LOG_INFO("Fetching current key frame: " << nameWithSequence->toUri());
+  Name keyFrameName = m_namespace.getKeyFrameName(m_currentKeyNum);
+  NS_LOG_INFO("Fetching current key frame: " << keyFrameName);
+  if (m_bundleSegments) {
+    SendBundleInterest(keyFrameName, m_outstandingKeys);
+    SendLayerInterests(keyFrameName, m_segmentsPerKeyFrame, m_outstandingKeys);
+    m_inFlightKeys++;
+    m_currentKeyNum++;
+    return;
+  }
   // fetch the current key frame
   for (int i = 0; i < m_segmentsPerKeyFrame; i++) {
-    Name interestName = Name(*nameWithSequence);
-    interestName.appendSequenceNumber(i);
-
-    shared_ptr<Interest> interest = make_shared<Interest>(interestName);
-    interest->setNonce(m_rand->GetValue(0, std::numeric_limits<uint32_t>::max()));
-    time::milliseconds interestLifeTime(m_interestLifeTime.GetMilliSeconds());
-    interest->setInterestLifetime(interestLifeTime);
+    shared_ptr<Interest> interest =
+      m_interestFactory.start(keyFrameName).appendSequenceNumber(i).build(m_interestLifeTime);
 
     m_transmittedInterests(interest, this, m_face);
     m_appLink->onReceiveInterest(*interest);
     m_outstandingKeys.push_back(std::make_pair(interest->getName(), Simulator::Now()));
+    TrackSegment(interest->getName());
 
     m_inFlightKeys++;
   }
+  SendParityInterests(keyFrameName, m_segmentsPerKeyFrame, m_outstandingKeys);
+  SendLayerInterests(keyFrameName, m_segmentsPerKeyFrame, m_outstandingKeys);
   m_currentKeyNum++;
 }
 
+void
+ConsumerRtc::UpdateLambda(shared_ptr<const Data> data, Time drd, bool isFresh)
+{
+  if (m_pipelineControl != nullptr) {
+    m_pipelineControl->OnData(drd, isFresh, IsCongestionMarked(*data));
+    m_lambda = m_pipelineControl->GetLambda();
+    return;
+  }
+
+  uint32_t lambda = ceil(m_DRD.GetSeconds() / m_samplePeriod);
+  if (lambda > m_lambda && IsCongestionMarked(*data)) {
+    NS_LOG_DEBUG("Congestion mark on " << data->getName() << ", keeping lambda at " << m_lambda);
+    return;
+  }
+
+  m_lambda = lambda;
+  std::cerr << "Lambda: " << m_lambda << std::endl;
+}
+
 bool
 ConsumerRtc::lastSegmentOfFrame(std::vector<std::pair<Name, Time>>::iterator it)
 {
@@ -277,12 +430,14 @@ ConsumerRtc::lastSegmentOfFrame(std::vector<std::pair<Name, Time>>::iterator it)
   }
   auto element_before = it;
   auto element_after = it;
+  RtcName current = m_namespace.parse(it->first);
   // segment at the beginning of the pipeline
   if (it == m_outstandingDeltas.begin()) {
     element_after++;
-    if (element_after->first.at(2).toUri() == "delta" && element_after->first.at(5) != it->first.at(5))
+    RtcName after = m_namespace.parse(element_after->first);
+    if (after.type == RTC_FRAME_DELTA && after.keyId != current.keyId)
       return true;
-    else if (element_after->first.at(2).toUri() == "delta" && element_after->first.at(3) != it->first.at(3))
+    else if (after.type == RTC_FRAME_DELTA && after.deltaId != current.deltaId)
       return true;
     else
       return false;
@@ -290,9 +445,10 @@ ConsumerRtc::lastSegmentOfFrame(std::vector<std::pair<Name, Time>>::iterator it)
   // segment at the end of the pipeline
   else if (it == m_outstandingDeltas.end() - 1) {
     element_before--;
-    if (element_before->first.at(2).toUri() == "delta" && element_before->first.at(5) != it->first.at(5))
+    RtcName before = m_namespace.parse(element_before->first);
+    if (before.type == RTC_FRAME_DELTA && before.keyId != current.keyId)
       return true;
-    else if (element_before->first.at(2).toUri() == "delta" && element_before->first.at(3) != it->first.at(3))
+    else if (before.type == RTC_FRAME_DELTA && before.deltaId != current.deltaId)
       return true;
     else
       return false;
@@ -301,9 +457,11 @@ ConsumerRtc::lastSegmentOfFrame(std::vector<std::pair<Name, Time>>::iterator it)
   else {
     element_before--;
     element_after++;
-    if ((element_before->first.at(2).toUri() == "delta" && element_before->first.at(5) != it->first.at(5)) && (element_after->first.at(5).toUri() == "delta" && element_after->first.at(5) != it->first.at(5)))
+    RtcName before = m_namespace.parse(element_before->first);
+    RtcName after = m_namespace.parse(element_after->first);
+    if ((before.type == RTC_FRAME_DELTA && before.keyId != current.keyId) && (after.type == RTC_FRAME_DELTA && after.keyId != current.keyId))
       return true;
-    else if ((element_before->first.at(2).toUri() == "delta" && element_before->first.at(3) != it->first.at(3)) && (element_after->first.at(2).toUri() == "delta" && element_after->first.at(3) != it->first.at(3)))
+    else if ((before.type == RTC_FRAME_DELTA && before.deltaId != current.deltaId) && (after.type == RTC_FRAME_DELTA && after.deltaId != current.deltaId))
       return true;
     else
       return false;
@@ -332,8 +490,7 @@ ConsumerRtc::PreviouslyGeneratedDeltaFrameSegmentReceived(shared_ptr<const Data>
       //   m_outputFileInterarrival << Simulator::Now().GetSeconds() <<  "," << interArrivalDelay.GetMilliSeconds() << "," << data->getName() << "\n";
       //   m_outputFileInterarrival.flush();
       // }
-      m_lambda = ceil(m_DRD.GetSeconds() / m_samplePeriod);
-      std::cerr << "Lambda: " << m_lambda << std::endl;
+      UpdateLambda(data, roundtrip, false);
       return true;
     }
   }
@@ -389,14 +546,14 @@ ConsumerRtc::DeltaFrameSegmentReceived(shared_ptr<const Data> data)
       m_outputFile << Simulator::Now().GetSeconds() <<  "," << roundtrip.GetMilliSeconds() << "," << data->getName() << "\n";
       m_outputFile.flush();
 
-      if (data->getName().at(-1).toSequenceNumber() == 0) {
+      RtcName parsed = m_namespace.parse(data->getName());
+      if ((parsed.segment == 0 && !parsed.hasLayer()) || parsed.isFrame()) {
         // interArrival Delay only for first segment of key frame
         interArrivalDelay = this->CheckIfDataFresh();
         m_outputFileInterarrival << Simulator::Now().GetSeconds() <<  "," << interArrivalDelay.GetMilliSeconds() << "," << data->getName() << "\n";
         m_outputFileInterarrival.flush();
       }
-      m_lambda = ceil(m_DRD.GetSeconds() / m_samplePeriod);
-      std::cerr << "Lambda: " << m_lambda << std::endl;
+      UpdateLambda(data, roundtrip, m_isDataFresh);
       break;
     }
   }
@@ -406,6 +563,23 @@ void
 ConsumerRtc::OnData(shared_ptr<const Data> data)
 {
   NS_LOG_FUNCTION_NOARGS();
+  RtcName parsed = m_namespace.parse(data->getName());
+  if (m_playout->OnSegment(parsed)) {
+    CancelRemainingSegments(data->getName(), parsed);
+  }
+
+  auto segment = m_segmentStates.find(data->getName());
+  if (segment != m_segmentStates.end()) {
+    if (segment->second.nRetx == 0) { // Karn's algorithm
+      m_rtt->Measurement(Simulator::Now() - segment->second.lastSent);
+      m_minRtt = std::min(m_minRtt, Simulator::Now() - segment->second.lastSent);
+      m_lossRate += (0 - m_lossRate) / 16;
+    }
+    m_segmentStates.erase(segment);
+  }
+  if (IsCongestionMarked(*data)) {
+    m_nCongestionEvents++;
+  }
   // Data for initial Interest(s)
   if (!m_bootstrap_done) {
     Time interArrivalDelay = Seconds(0);
@@ -424,11 +598,15 @@ ConsumerRtc::OnData(shared_ptr<const Data> data)
     m_outputFileInterarrival.flush();
 
     m_lambda = ceil(m_DRD.GetSeconds() / m_samplePeriod);
+    if (m_pipelineControl != nullptr) {
+      m_pipelineControl->Reset(Seconds(m_samplePeriod), m_DRD);
+      m_lambda = m_pipelineControl->GetLambda();
+    }
     NS_LOG_INFO("> Initial Data packet received for: " << data->getName());
     m_exactDataName = data->getName().getPrefix(-4);
     // extract latest sequence number
-    uint64_t currentDeltaNum = data->getName().at(-4).toSequenceNumber();
-    uint64_t currentKeyNum = data->getName().at(-2).toSequenceNumber();
+    uint64_t currentDeltaNum = parsed.deltaId;
+    uint64_t currentKeyNum = parsed.keyId;
     if (m_currentDeltaNum <= currentDeltaNum && m_currentKeyNum <= currentKeyNum) {
       m_currentDeltaNum = currentDeltaNum;
       m_currentKeyNum = currentKeyNum;
@@ -457,7 +635,7 @@ ConsumerRtc::OnData(shared_ptr<const Data> data)
     NS_LOG_INFO("Bootstrap done");
     m_segmentsReceived++;
     // key frame segment received
-    if (data->getName().at(2).toUri() == "key") {
+    if (parsed.type == RTC_FRAME_KEY) {
       KeyFrameSegmentReceived(data);
       NS_LOG_INFO("Key Received");
       if (m_outstandingKeys.size() == 0) {
@@ -487,6 +665,237 @@ ConsumerRtc::OnTimeout(uint32_t sequenceNumber)
   NS_LOG_INFO("Timeout for sequence number: " << sequenceNumber);
 }
 
+void
+ConsumerRtc::TrackSegment(const Name& name)
+{
+  m_segmentStates[name] = SegmentState{Simulator::Now(), m_rtt->RetransmitTimeout(), 0};
+}
+
+void
+ConsumerRtc::CheckSegmentTimeouts()
+{
+  Time now = Simulator::Now();
+
+  std::vector<Name> timedOut;
+  for (const auto& segment : m_segmentStates) {
+    if (now - segment.second.lastSent >= segment.second.timeout) {
+      timedOut.push_back(segment.first);
+    }
+  }
+  for (const Name& name : timedOut) {
+    OnSegmentTimeout(name);
+  }
+
+  m_segmentTimeoutEvent =
+    Simulator::Schedule(m_retxTimer, &ConsumerRtc::CheckSegmentTimeouts, this);
+}
+
+void
+ConsumerRtc::OnSegmentTimeout(const Name& name)
+{
+  SegmentState& state = m_segmentStates[name];
+  Time now = Simulator::Now();
+
+  if (state.nRetx == 0) {
+    m_lossRate += (1 - m_lossRate) / 16;
+    m_nCongestionEvents++;
+    if (m_pipelineControl != nullptr) {
+      m_pipelineControl->OnTimeout();
+      m_lambda = m_pipelineControl->GetLambda();
+    }
+  }
+
+  // retransmit only if Data can still arrive before the frame is due for display
+  Time deadline = m_playout->GetPlayoutDeadline(m_namespace.parse(name));
+  if (state.nRetx >= m_maxRetx || now + m_rtt->GetCurrentEstimate() > deadline) {
+    NS_LOG_INFO("Abandoning segment " << name << " after " << state.nRetx << " retransmissions");
+    m_segmentStates.erase(name);
+    AbandonSegment(name);
+    return;
+  }
+
+  state.lastSent = now;
+  state.timeout = state.timeout + state.timeout;
+  state.nRetx++;
+
+  NS_LOG_INFO("> Retransmitting Interest for segment: " << name);
+  shared_ptr<Interest> interest = m_interestFactory.build(name, m_interestLifeTime);
+  if (m_namespace.parse(name).isFrame()) {
+    interest->setMaxSuffixComponents(1);
+  }
+  m_transmittedInterests(interest, this, m_face);
+  m_appLink->onReceiveInterest(*interest);
+}
+
+void
+ConsumerRtc::AbandonSegment(const Name& name)
+{
+  m_segmentAbandoned(name);
+
+  for (auto it = m_outstandingDeltas.begin(); it != m_outstandingDeltas.end(); it++) {
+    if (it->first == name) {
+      if (lastSegmentOfFrame(it))
+        m_inFlightFrames--;
+      m_outstandingDeltas.erase(it);
+      // refill the pipeline
+      this->ScheduleNextPacket();
+      return;
+    }
+  }
+
+  for (auto it = m_outstandingKeys.begin(); it != m_outstandingKeys.end(); it++) {
+    if (it->first == name) {
+      m_outstandingKeys.erase(it);
+      if (m_outstandingKeys.size() == 0) {
+        // fetch next key frame when generated
+        fetchCurrentKeyFrame();
+      }
+      return;
+    }
+  }
+
+  for (auto it = m_outstandingPreviousDeltas.begin(); it != m_outstandingPreviousDeltas.end(); it++) {
+    if (it->first == name) {
+      m_outstandingPreviousDeltas.erase(it);
+      return;
+    }
+  }
+}
+
+uint32_t
+ConsumerRtc::GetNParityToRequest(uint32_t nSegments) const
+{
+  uint32_t nPublished = static_cast<uint32_t>(std::ceil(m_fecRatio * nSegments));
+  if (!m_isAdaptiveFec) {
+    return nPublished;
+  }
+  return std::min(nPublished, static_cast<uint32_t>(std::ceil(2 * m_lossRate * nSegments)));
+}
+
+void
+ConsumerRtc::SendParityInterests(const Name& frameName, uint32_t nSegments,
+                                 std::vector<std::pair<Name, Time>>& outstanding)
+{
+  uint32_t nParity = GetNParityToRequest(nSegments);
+  for (uint32_t i = 0; i < nParity; i++) {
+    shared_ptr<Interest> interest =
+      m_interestFactory.build(RtcNamespace::getParityName(frameName, i), m_interestLifeTime);
+
+    m_transmittedInterests(interest, this, m_face);
+    m_appLink->onReceiveInterest(*interest);
+    outstanding.push_back(std::make_pair(interest->getName(), Simulator::Now()));
+    TrackSegment(interest->getName());
+  }
+}
+
+void
+ConsumerRtc::SendBundleInterest(const Name& frameName,
+                                std::vector<std::pair<Name, Time>>& outstanding)
+{
+  shared_ptr<Interest> interest = m_interestFactory.build(frameName, m_interestLifeTime);
+  // frame name is a prefix of its segments, which must not satisfy the Interest
+  interest->setMaxSuffixComponents(1);
+
+  NS_LOG_INFO("> Interest for bundle of frame: " << frameName);
+  m_transmittedInterests(interest, this, m_face);
+  m_appLink->onReceiveInterest(*interest);
+  outstanding.push_back(std::make_pair(interest->getName(), Simulator::Now()));
+  TrackSegment(interest->getName());
+}
+
+void
+ConsumerRtc::SendLayerInterests(const Name& frameName, uint32_t nSegments,
+                                std::vector<std::pair<Name, Time>>& outstanding)
+{
+  for (uint32_t layer = 1; layer < m_nLayers; layer++) {
+    Name layerName = RtcNamespace::getLayerName(frameName, layer);
+    for (uint32_t i = 0; i < GetNLayerSegments(nSegments); i++) {
+      shared_ptr<Interest> interest =
+        m_interestFactory.start(layerName).appendSequenceNumber(i).build(m_interestLifeTime);
+
+      m_transmittedInterests(interest, this, m_face);
+      m_appLink->onReceiveInterest(*interest);
+      outstanding.push_back(std::make_pair(interest->getName(), Simulator::Now()));
+      TrackSegment(interest->getName());
+    }
+  }
+}
+
+uint32_t
+ConsumerRtc::GetNLayerSegments(uint32_t nSegments) const
+{
+  return static_cast<uint32_t>(std::ceil(m_enhancementSegmentsRatio * nSegments));
+}
+
+double
+ConsumerRtc::GetLayersDemand(uint32_t nLayers) const
+{
+  auto getFrameSegments = [=] (uint32_t nSegments) {
+    return nSegments + (nLayers - 1) * GetNLayerSegments(nSegments);
+  };
+
+  // one key frame and SamplingRate-1 delta frames per second
+  return getFrameSegments(m_segmentsPerKeyFrame)
+         + (m_samplingRate - 1.0) * getFrameSegments(m_segmentsPerDeltaFrame);
+}
+
+void
+ConsumerRtc::AdaptLayers()
+{
+  m_adaptationEvent = Simulator::Schedule(m_adaptationPeriod, &ConsumerRtc::AdaptLayers, this);
+
+  double throughput = (m_segmentsReceived - m_segmentsReceivedAtAdaptation)
+                      / m_adaptationPeriod.GetSeconds();
+  uint32_t nCongestionEvents = m_nCongestionEvents;
+  m_segmentsReceivedAtAdaptation = m_segmentsReceived;
+  m_nCongestionEvents = 0;
+  m_nPeriodsSinceDecrease++;
+
+  if (!m_bootstrap_done || m_minRtt == Time::Max()) {
+    return;
+  }
+
+  double demand = GetLayersDemand(m_nLayers);
+  Time queuingDelay = std::max(Time(0), m_rtt->GetCurrentEstimate() - m_minRtt);
+  NS_LOG_DEBUG("Layers " << m_nLayers << ": throughput " << throughput << " segments/s, demand "
+               << demand << " segments/s, queuing delay " << queuingDelay.As(Time::MS)
+               << ", congestion events " << nCongestionEvents);
+
+  if (m_nLayers > 1 && (throughput < 0.9 * demand || queuingDelay > m_queuingDelayThreshold
+                        || nCongestionEvents > 0)) {
+    m_nLayers = m_nLayers - 1;
+    m_nPeriodsSinceDecrease = 0;
+    NS_LOG_INFO("Decreasing number of requested layers to " << m_nLayers);
+  }
+  else if (m_nLayers < m_maxLayers && throughput >= 0.95 * demand
+           && queuingDelay < m_queuingDelayThreshold / 2 && nCongestionEvents == 0
+           && m_nPeriodsSinceDecrease >= 2) {
+    m_nLayers = m_nLayers + 1;
+    NS_LOG_INFO("Increasing number of requested layers to " << m_nLayers);
+  }
+}
+
+void
+ConsumerRtc::CancelRemainingSegments(const Name& name, const RtcName& parsed)
+{
+  auto isRemainingSegment = [&] (const std::pair<Name, Time>& segment) {
+    RtcName remaining = m_namespace.parse(segment.first);
+    if (segment.first == name || remaining.hasLayer() || !remaining.isSameFrame(parsed)) {
+      return false;
+    }
+    NS_LOG_DEBUG("Frame complete, dropping Interest for " << segment.first);
+    m_segmentStates.erase(segment.first);
+    return true;
+  };
+
+  // afterwards, the segment of name (if still outstanding) and enhancement layer segments are
+  // the last ones of the frame
+  for (auto* outstanding : {&m_outstandingDeltas, &m_outstandingKeys, &m_outstandingPreviousDeltas}) {
+    outstanding->erase(std::remove_if(outstanding->begin(), outstanding->end(), isRemainingSegment),
+                       outstanding->end());
+  }
+}
+
 Time
 ConsumerRtc::CheckIfDataFresh()
 {
@@ -494,7 +903,8 @@ ConsumerRtc::CheckIfDataFresh()
   Time interArrivalDelay = Simulator::Now() - m_previousDataArrival;
   m_previousDataArrival = Simulator::Now();
   NS_LOG_INFO("Inter arrival delay: " << interArrivalDelay.GetSeconds());
-  if (interArrivalDelay.GetSeconds() >= (80 * m_samplePeriod / 100))
+  m_isDataFresh = interArrivalDelay.GetSeconds() >= (80 * m_samplePeriod / 100);
+  if (m_isDataFresh)
     NS_LOG_INFO("Catching up with the producer...");
   else
     NS_LOG_INFO("Probably received cached data...");
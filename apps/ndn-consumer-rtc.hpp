@@ -23,8 +23,13 @@
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 
 #include "ndn-consumer.hpp"
+#include "ns3/ndnSIM/utils/ndn-rtc-name.hpp"
+#include "ns3/ndnSIM/utils/ndn-rtc-playout.hpp"
+#include "ns3/ndnSIM/utils/ndn-rtc-pipeline-control.hpp"
+#include "ns3/traced-value.h"
 
 #include <fstream>
+#include <map>
 
 namespace ns3 {
 namespace ndn {
@@ -32,6 +37,38 @@ namespace ndn {
 /**
  * @ingroup ndn-apps
  * @brief Ndn application for RTC consumer
+ *
+ * The pipeline size (lambda, the number of frames requested ahead of the producer) is managed
+ * by the RtcPipelineControl subclass named by the PipelineControl attribute, from delays of
+ * fresh Data, congestion marks, and timeouts.
+ *
+ * Interests for frame segments are retransmitted when they time out (RTO from the RTT
+ * estimator, doubled on every retransmission), up to MaxRetransmissions times.  A segment is
+ * abandoned instead, if the Data cannot arrive before its frame is due for display (see
+ * RtcPlayout), so that lost segments do not hold the pipeline.
+ *
+ * If FecRatio is set (to the same value as for the producer), FEC parity segments are
+ * requested together with the data segments of every frame.  A frame is complete once as
+ * many distinct data or parity segments as the frame has data segments have arrived; the
+ * remaining Interests of the frame are then dropped.  With AdaptiveFec, only as many parity
+ * segments are requested as twice the segment loss rate observed by the consumer requires.
+ *
+ * With BundleSegments, every frame is requested with a single Interest for the frame name,
+ * answered by a single Data carrying all segments of the frame, which NDNLP fragments into
+ * link-MTU-sized packets on every hop (fragmentation and reassembly are enabled by
+ * StackHelper).  Compared to per-segment fetching, this requires one PIT entry per frame
+ * instead of one per segment, while a lost fragment causes the whole frame to be
+ * retransmitted.  Parity segments are not requested for bundles.
+ *
+ * If the producer publishes SVC enhancement layers (NumLayers > 1), segments of the first
+ * Layers-1 enhancement layers are requested together with the base layer of every frame.
+ * With AdaptLayers, the number of layers is re-evaluated every AdaptationPeriod, similar to
+ * adaptive bitrate selection: one layer is dropped when the segment throughput falls below the
+ * demand of the current layers, the queuing delay (smoothed RTT above the minimum RTT) exceeds
+ * QueuingDelayThreshold, or congestion marks or timeouts were seen during the period; one
+ * layer is added when all requested segments arrive without any of these signals for two
+ * periods in a row after the last decrease.  Frames are complete (and displayed) as soon as
+ * their base layer is complete.
  */
 class ConsumerRtc : public Consumer {
 public:
@@ -52,6 +89,8 @@ public:
   virtual void
   OnTimeout(uint32_t sequenceNumber);
 
+  typedef void (*SegmentCallback)(const Name& segment);
+
 protected:
   /**
    * \brief Constructs the Interest packet for an upcoming frame and sends it
@@ -112,6 +151,102 @@ private:
   bool
   lastSegmentOfFrame(std::vector<std::pair<Name, Time>>::iterator it);
 
+  /**
+   * @brief Update pipeline size (lambda) after segment @p data is received with DRD @p drd
+   *
+   * If @p data carries a congestion mark, lambda is not allowed to grow: a larger DRD caused
+   * by queuing would otherwise increase the number of outstanding Interests and make the
+   * queue grow further.
+   *
+   * @param isFresh false if @p data was cached or generated before it was requested
+   */
+  void
+  UpdateLambda(shared_ptr<const Data> data, Time drd, bool isFresh);
+
+  void
+  SetPipelineControl(const std::string& typeId);
+
+  std::string
+  GetPipelineControl() const;
+
+  /**
+   * @brief Start retransmission timer of segment Interest @p name
+   */
+  void
+  TrackSegment(const Name& name);
+
+  /**
+   * @brief Periodically check for timed out segment Interests
+   */
+  void
+  CheckSegmentTimeouts();
+
+  /**
+   * @brief Retransmit Interest for segment @p name, or abandon it
+   */
+  void
+  OnSegmentTimeout(const Name& name);
+
+  /**
+   * @brief Remove segment @p name from the pipeline without waiting for it any longer
+   */
+  void
+  AbandonSegment(const Name& name);
+
+  /**
+   * @brief Get number of parity segments to request for a frame with @p nSegments segments
+   */
+  uint32_t
+  GetNParityToRequest(uint32_t nSegments) const;
+
+  /**
+   * @brief Request parity segments of frame @p frameName, adding them to @p outstanding
+   */
+  void
+  SendParityInterests(const Name& frameName, uint32_t nSegments,
+                      std::vector<std::pair<Name, Time>>& outstanding);
+
+  /**
+   * @brief Request bundle of all segments of frame @p frameName, adding it to @p outstanding
+   */
+  void
+  SendBundleInterest(const Name& frameName, std::vector<std::pair<Name, Time>>& outstanding);
+
+  /**
+   * @brief Request segments of enhancement layers 1..Layers-1 of frame @p frameName, whose
+   * base layer has @p nSegments segments, adding them to @p outstanding
+   */
+  void
+  SendLayerInterests(const Name& frameName, uint32_t nSegments,
+                     std::vector<std::pair<Name, Time>>& outstanding);
+
+  /**
+   * @brief Get number of segments of each enhancement layer of a frame whose base layer has
+   * @p nSegments segments
+   */
+  uint32_t
+  GetNLayerSegments(uint32_t nSegments) const;
+
+  /**
+   * @brief Get number of segments per second needed to fetch @p nLayers layers of the stream
+   */
+  double
+  GetLayersDemand(uint32_t nLayers) const;
+
+  /**
+   * @brief Periodically adjust the number of fetched layers to throughput and delay
+   */
+  void
+  AdaptLayers();
+
+  /**
+   * @brief Drop outstanding Interests of the frame of @p name, which has just been completed
+   *
+   * Interests for enhancement layers of the frame are kept.
+   */
+  void
+  CancelRemainingSegments(const Name& name, const RtcName& parsed);
+
 protected:
   double m_frequency; // Frequency of interest packets (in hertz)
   bool m_firstTime;
@@ -119,9 +254,12 @@ protected:
   std::string m_randomType;
   uint32_t m_mustBeFresh;
   Name m_conferencePrefix;
+  RtcNamespace m_namespace; ///< @brief names of the stream, derived from m_conferencePrefix
+  Ptr<RtcPlayout> m_playout;
 
   Time m_DRD;
-  uint32_t m_lambda;
+  TracedValue<uint32_t> m_lambda;
+  Ptr<RtcPipelineControl> m_pipelineControl; ///< @brief lambda controller, if any
   uint32_t m_inFlightDeltas;
   uint32_t m_inFlightKeys;
 
@@ -156,6 +294,38 @@ protected:
   uint32_t m_inFlightFrames;
 
   bool m_startFromNextKeyFrame;
+
+  /// @brief Retransmission state of an outstanding segment Interest
+  struct SegmentState {
+    Time lastSent;
+    Time timeout; ///< @brief RTO when first sent, doubled on every retransmission
+    uint32_t nRetx;
+  };
+  std::map<Name, SegmentState> m_segmentStates;
+  uint32_t m_maxRetx;
+  EventId m_segmentTimeoutEvent;
+
+  double m_fecRatio;
+  bool m_isAdaptiveFec;
+  double m_lossRate; ///< @brief EWMA of segment losses (first timeouts) per segment
+
+  bool m_bundleSegments;
+
+  uint32_t m_maxLayers; ///< @brief number of layers published by the producer
+  double m_enhancementSegmentsRatio;
+  TracedValue<uint32_t> m_nLayers; ///< @brief number of layers currently requested
+  bool m_isAdaptiveLayers;
+  Time m_adaptationPeriod;
+  Time m_queuingDelayThreshold;
+  EventId m_adaptationEvent;
+  Time m_minRtt;
+  uint64_t m_segmentsReceivedAtAdaptation;
+  uint32_t m_nCongestionEvents; ///< @brief congestion marks and timeouts since last adaptation
+  uint32_t m_nPeriodsSinceDecrease;
+
+  bool m_isDataFresh; ///< @brief whether the last frame arrived about one frame period after the previous one
+
+  TracedCallback<const Name&> m_segmentAbandoned;
 };
 
 } // namespace ndn
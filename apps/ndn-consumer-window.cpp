@@ -26,6 +26,7 @@
 #include "ns3/string.h"
 #include "ns3/uinteger.h"
 #include "ns3/double.h"
+#include "ns3/object-factory.h"
 
 NS_LOG_COMPONENT_DEFINE("ndn.ConsumerWindow");
 
@@ -66,11 +67,21 @@ ConsumerWindow::GetTypeId(void)
                     MakeUintegerAccessor(&ConsumerWindow::GetSeqMax, &ConsumerWindow::SetSeqMax),
                     MakeUintegerChecker<uint32_t>())
 
-      .AddAttribute("InitialWindowOnTimeout", "Set window to initial value when timeout occurs",
+      .AddAttribute("InitialWindowOnTimeout", "Set window to initial value when timeout occurs "
+                                                "(only if CongestionControl is not set)",
                     BooleanValue(true),
                     MakeBooleanAccessor(&ConsumerWindow::m_setInitialWindowOnTimeout),
                     MakeBooleanChecker())
 
+      .AddAttribute("CongestionControl",
+                    "TypeId of the congestion controller managing the window (e.g., "
+                    "ns3::ndn::CongestionControlAimd).  If empty, the window grows by one per "
+                    "Data and is reset on timeout",
+                    StringValue(""),
+                    MakeStringAccessor(&ConsumerWindow::SetCongestionControl,
+                                       &ConsumerWindow::GetCongestionControl),
+                    MakeStringChecker())
+
       .AddTraceSource("WindowTrace",
                       "Window that controls how many outstanding interests are allowed",
                       MakeTraceSourceAccessor(&ConsumerWindow::m_window),
@@ -88,6 +99,44 @@ ConsumerWindow::ConsumerWindow()
 {
 }
 
+void
+ConsumerWindow::SetCongestionControl(const std::string& typeId)
+{
+  if (typeId.empty()) {
+    m_congestionControl = nullptr;
+    return;
+  }
+
+  ObjectFactory factory(typeId);
+  m_congestionControl = factory.Create<CongestionControl>();
+}
+
+std::string
+ConsumerWindow::GetCongestionControl() const
+{
+  if (m_congestionControl == nullptr) {
+    return "";
+  }
+  return m_congestionControl->GetInstanceTypeId().GetName();
+}
+
+void
+ConsumerWindow::StartApplication()
+{
+  if (m_congestionControl != nullptr) {
+    m_congestionControl->Reset(m_initialWindow);
+    UpdateWindow();
+  }
+
+  Consumer::StartApplication();
+}
+
+void
+ConsumerWindow::UpdateWindow()
+{
+  m_window = static_cast<uint32_t>(m_congestionControl->GetWindow());
+}
+
 void
 ConsumerWindow::SetWindow(uint32_t window)
 {
@@ -184,9 +233,30 @@ ConsumerWindow::ScheduleNextPacket()
 void
 ConsumerWindow::OnData(shared_ptr<const Data> contentObject)
 {
+  Time rtt; // zero, unless there is a valid sample
+  if (m_congestionControl != nullptr) {
+    uint32_t seq = contentObject->getName().at(-1).toSequenceNumber();
+    const SeqStateTable::Entry* entry = m_seqs.find(seq);
+    if (entry != nullptr && entry->retxCount == 1) { // Karn's algorithm
+      rtt = Simulator::Now() - entry->lastSent;
+    }
+  }
+
   Consumer::OnData(contentObject);
 
-  m_window = m_window + 1;
+  bool isMarked = IsCongestionMarked(*contentObject);
+  if (m_congestionControl != nullptr) {
+    if (isMarked) {
+      m_congestionControl->OnCongestionMark(rtt);
+    }
+    else {
+      m_congestionControl->OnData(rtt);
+    }
+    UpdateWindow();
+  }
+  else if (!isMarked) {
+    m_window = m_window + 1;
+  }
 
   if (m_inFlight > static_cast<uint32_t>(0))
     m_inFlight--;
@@ -201,7 +271,11 @@ ConsumerWindow::OnTimeout(uint32_t sequenceNumber)
   if (m_inFlight > static_cast<uint32_t>(0))
     m_inFlight--;
 
-  if (m_setInitialWindowOnTimeout) {
+  if (m_congestionControl != nullptr) {
+    m_congestionControl->OnTimeout();
+    UpdateWindow();
+  }
+  else if (m_setInitialWindowOnTimeout) {
     // m_window = std::max<uint32_t> (0, m_window - 1);
     m_window = m_initialWindow;
   }
@@ -210,6 +284,20 @@ ConsumerWindow::OnTimeout(uint32_t sequenceNumber)
   Consumer::OnTimeout(sequenceNumber);
 }
 
+void
+ConsumerWindow::OnNack(shared_ptr<const lp::Nack> nack)
+{
+  Consumer::OnNack(nack);
+
+  // other reasons (e.g., NoRoute) do not indicate congestion; the Interest is retransmitted
+  // after the timeout in any case
+  if (m_congestionControl != nullptr && nack->getReason() == lp::NackReason::CONGESTION) {
+    m_congestionControl->OnNack();
+    UpdateWindow();
+    NS_LOG_DEBUG("Window: " << m_window << ", InFlight: " << m_inFlight);
+  }
+}
+
 void
 ConsumerWindow::WillSendOutInterest(uint32_t sequenceNumber)
 {
@@ -24,6 +24,7 @@
 
 #include "ndn-consumer.hpp"
 #include "ns3/traced-value.h"
+#include "ns3/ndnSIM/utils/ndn-congestion-control.hpp"
 
 namespace ns3 {
 namespace ndn {
@@ -32,6 +33,13 @@ namespace ndn {
  * @ingroup ndn-apps
  * \brief Ndn application for sending out Interest packets (window-based)
  *
+ * By default, the window grows by one on every Data without a congestion mark and is reset
+ * to its initial value on timeout.  If the CongestionControl attribute names a
+ * CongestionControl subclass (e.g., ns3::ndn::CongestionControlAimd,
+ * ns3::ndn::CongestionControlCubic, or ns3::ndn::CongestionControlVegas), the window is
+ * instead managed by that controller, which also reacts to RTT samples, congestion marks, and
+ * NACKs with reason Congestion.
+ *
  * !!! ATTENTION !!! This is highly experimental and relies on experimental features of the
  *simulator.
  * Behavior may be unpredictable if used incorrectly.
@@ -50,6 +58,9 @@ public:
   virtual void
   OnData(shared_ptr<const Data> contentObject);
 
+  virtual void
+  OnNack(shared_ptr<const lp::Nack> nack);
+
   virtual void
   OnTimeout(uint32_t sequenceNumber);
 
@@ -67,7 +78,22 @@ protected:
   virtual void
   ScheduleNextPacket();
 
+  virtual void
+  StartApplication();
+
 private:
+  /**
+   * @brief Set window from the congestion controller
+   */
+  void
+  UpdateWindow();
+
+  void
+  SetCongestionControl(const std::string& typeId);
+
+  std::string
+  GetCongestionControl() const;
+
   virtual void
   SetWindow(uint32_t window);
 
@@ -98,6 +124,7 @@ private:
 
   uint32_t m_initialWindow;
   bool m_setInitialWindowOnTimeout;
+  Ptr<CongestionControl> m_congestionControl; ///< @brief window controller, if any
 
   TracedValue<uint32_t> m_window;
   TracedValue<uint32_t> m_inFlight;
@@ -21,8 +21,6 @@
 
 #include "ndn-consumer-zipf-mandelbrot.hpp"
 
-#include <math.h>
-
 NS_LOG_COMPONENT_DEFINE("ndn.ConsumerZipfMandelbrot");
 
 namespace ns3 {
@@ -77,17 +75,8 @@ ConsumerZipfMandelbrot::SetNumberOfContents(uint32_t numOfContents)
 
   NS_LOG_DEBUG(m_q << " and " << m_s << " and " << m_N);
 
-  m_Pcum = std::vector<double>(m_N + 1);
-
-  m_Pcum[0] = 0.0;
-  for (uint32_t i = 1; i <= m_N; i++) {
-    m_Pcum[i] = m_Pcum[i - 1] + 1.0 / std::pow(i + m_q, m_s);
-  }
-
-  for (uint32_t i = 1; i <= m_N; i++) {
-    m_Pcum[i] = m_Pcum[i] / m_Pcum[m_N];
-    NS_LOG_LOGIC("Cumulative probability [" << i << "]=" << m_Pcum[i]);
-  }
+  // N, q, and s are set one by one during initialization; the table is (re)built on first use
+  m_sampler.reset();
 }
 
 uint32_t
@@ -134,9 +123,8 @@ ConsumerZipfMandelbrot::SendPacket()
 
   // std::cout << Simulator::Now ().ToDouble (Time::S) << "s max -> " << m_seqMax << "\n";
 
-  while (m_retxSeqs.size()) {
-    seq = *m_retxSeqs.begin();
-    m_retxSeqs.erase(m_retxSeqs.begin());
+  while (m_seqs.hasPendingRetx()) {
+    seq = m_seqs.popRetx();
 
     // NS_ASSERT (m_seqLifetimes.find (seq) != m_seqLifetimes.end ());
     // if (m_seqLifetimes.find (seq)->time <= Simulator::Now ())
@@ -147,7 +135,7 @@ ConsumerZipfMandelbrot::SendPacket()
     //     sequence number
     //     continue;
     //   }
-    NS_LOG_DEBUG("=interest seq " << seq << " from m_retxSeqs");
+    NS_LOG_DEBUG("=interest seq " << seq << " from m_seqs");
     break;
   }
 
@@ -165,29 +153,21 @@ ConsumerZipfMandelbrot::SendPacket()
 
   // std::cout << Simulator::Now ().ToDouble (Time::S) << "s -> " << seq << "\n";
 
-  //
-  shared_ptr<Name> nameWithSequence = make_shared<Name>(m_interestName);
-  nameWithSequence->appendSequenceNumber(seq);
-  //
-
-  shared_ptr<Interest> interest = make_shared<Interest>();
-  interest->setNonce(m_rand->GetValue(0, std::numeric_limits<uint32_t>::max()));
-  interest->setName(*nameWithSequence);
+  // LifeTime attribute has never been applied by this app, default lifetime is used instead
+  shared_ptr<Interest> interest =
+    m_interestFactory.start(m_interestName)
+      .appendSequenceNumber(seq)
+      .build(MilliSeconds(::ndn::DEFAULT_INTEREST_LIFETIME.count()));
 
   // NS_LOG_INFO ("Requesting Interest: \n" << *interest);
   NS_LOG_INFO("> Interest for " << seq << ", Total: " << m_seq << ", face: " << m_face->getId());
   NS_LOG_DEBUG("Trying to add " << seq << " with " << Simulator::Now() << ". already "
-                                << m_seqTimeouts.size() << " items");
-
-  m_seqTimeouts.insert(SeqTimeout(seq, Simulator::Now()));
-  m_seqFullDelay.insert(SeqTimeout(seq, Simulator::Now()));
+                                << m_seqs.getNPendingTimeouts() << " items");
 
-  m_seqLastDelay.erase(seq);
-  m_seqLastDelay.insert(SeqTimeout(seq, Simulator::Now()));
-
-  m_seqRetxCounts[seq]++;
+  m_seqs.onSent(seq, Simulator::Now());
 
   m_rtt->SentSeq(SequenceNumber32(seq), 1);
+  ScheduleRetxTimeout();
 
   m_transmittedInterests(interest, this, m_face);
   m_appLink->onReceiveInterest(*interest);
@@ -198,24 +178,18 @@ ConsumerZipfMandelbrot::SendPacket()
 uint32_t
 ConsumerZipfMandelbrot::GetNextSeq()
 {
-  uint32_t content_index = 1; //[1, m_N]
-  double p_sum = 0;
+  if (m_N == 0) {
+    return 1;
+  }
 
-  double p_random = m_seqRng->GetValue();
-  while (p_random == 0) {
-    p_random = m_seqRng->GetValue();
+  if (m_sampler == nullptr) {
+    m_sampler = AliasSampler::getZipfMandelbrot(m_N, m_q, m_s);
   }
-  // if (p_random == 0)
+
+  double p_random = m_seqRng->GetValue();
   NS_LOG_LOGIC("p_random=" << p_random);
-  for (uint32_t i = 1; i <= m_N; i++) {
-    p_sum = m_Pcum[i]; // m_Pcum[i] = m_Pcum[i-1] + p[i], p[0] = 0;   e.g.: p_cum[1] = p[1],
-                       // p_cum[2] = p[1] + p[2]
-    if (p_random <= p_sum) {
-      content_index = i;
-      break;
-    } // if
-  }   // for
-  // content_index = 1;
+
+  uint32_t content_index = m_sampler->sample(p_random) + 1; //[1, m_N]
   NS_LOG_DEBUG("RandomNumber=" << content_index);
   return content_index;
 }
@@ -27,6 +27,8 @@
 #include "ndn-consumer.hpp"
 #include "ndn-consumer-cbr.hpp"
 
+#include "ns3/ndnSIM/utils/ndn-alias-sampler.hpp"
+
 #include "ns3/ptr.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
@@ -47,6 +49,9 @@ namespace ndn {
  * The class implements an app which requests contents following Zipf-Mandelbrot Distribution
  * Here is the explaination of Zipf-Mandelbrot Distribution:
  *http://en.wikipedia.org/wiki/Zipf%E2%80%93Mandelbrot_law
+ *
+ * Contents are drawn in O(1) using AliasSampler; all consumers with the same
+ * NumberOfContents, q, and s share one sampling table.
  */
 class ConsumerZipfMandelbrot : public ConsumerCbr {
 public:
@@ -94,7 +99,7 @@ private:
   uint32_t m_N;               // number of the contents
   double m_q;                 // q in (k+q)^s
   double m_s;                 // s in (k+q)^s
-  std::vector<double> m_Pcum; // cumulative probability
+  shared_ptr<const AliasSampler> m_sampler; // shared popularity table, built on first use
 
   Ptr<UniformRandomVariable> m_seqRng; // RNG
 };
@@ -60,7 +60,8 @@ Consumer::GetTypeId(void)
                     MakeTimeAccessor(&Consumer::m_interestLifeTime), MakeTimeChecker())
 
       .AddAttribute("RetxTimer",
-                    "Timeout defining how frequent retransmission timeouts should be checked",
+                    "Granularity with which retransmission timeouts are detected (the timer is "
+                    "armed only for the earliest outstanding deadline)",
                     StringValue("50ms"),
                     MakeTimeAccessor(&Consumer::GetRetxTimer, &Consumer::SetRetxTimer),
                     MakeTimeChecker())
@@ -80,6 +81,7 @@ Consumer::GetTypeId(void)
 
 Consumer::Consumer()
   : m_rand(CreateObject<UniformRandomVariable>())
+  , m_interestFactory(m_rand)
   , m_seq(0)
   , m_seqMax(0) // don't request anything
 {
@@ -92,13 +94,11 @@ void
 Consumer::SetRetxTimer(Time retxTimer)
 {
   m_retxTimer = retxTimer;
-  if (m_retxEvent.IsRunning()) {
-    // m_retxEvent.Cancel (); // cancel any scheduled cleanup events
-    Simulator::Remove(m_retxEvent); // slower, but better for memory
-  }
+  m_retxTimerStart = Simulator::Now();
 
-  // schedule even with new timeout
-  m_retxEvent = Simulator::Schedule(m_retxTimer, &Consumer::CheckRetxTimeout, this);
+  // re-arm the timer according to the new granularity
+  m_retxEvent.Cancel();
+  ScheduleRetxTimeout();
 }
 
 Time
@@ -107,6 +107,41 @@ Consumer::GetRetxTimer() const
   return m_retxTimer;
 }
 
+void
+Consumer::ScheduleRetxTimeout()
+{
+  if (!m_seqs.hasPendingTimeouts()) {
+    // nothing outstanding; an already armed timer will find nothing and will not be re-armed
+    return;
+  }
+
+  Time now = Simulator::Now();
+  Time deadline = m_seqs.getEarliestTimeout().timeoutStart + m_rtt->RetransmitTimeout();
+  if (deadline < now) {
+    deadline = now;
+  }
+
+  // round the deadline up to the RetxTimer grid, so timeouts are detected at exactly the
+  // same moments as with periodic checking every RetxTimer
+  if (m_retxTimer.IsStrictlyPositive()) {
+    int64_t period = m_retxTimer.GetTimeStep();
+    int64_t offset = (deadline - m_retxTimerStart).GetTimeStep();
+    if (offset > 0) {
+      deadline = m_retxTimerStart + TimeStep(((offset + period - 1) / period) * period);
+    }
+  }
+
+  if (m_retxEvent.IsRunning()) {
+    if (m_retxEvent.GetTs() <= static_cast<uint64_t>(deadline.GetTimeStep())) {
+      // armed timer will fire no later than needed and will re-arm itself, if necessary
+      return;
+    }
+    m_retxEvent.Cancel();
+  }
+
+  m_retxEvent = Simulator::Schedule(deadline - now, &Consumer::CheckRetxTimeout, this);
+}
+
 void
 Consumer::CheckRetxTimeout()
 {
@@ -115,20 +150,17 @@ Consumer::CheckRetxTimeout()
   Time rto = m_rtt->RetransmitTimeout();
   // NS_LOG_DEBUG ("Current RTO: " << rto.ToDouble (Time::S) << "s");
 
-  while (!m_seqTimeouts.empty()) {
-    SeqTimeoutsContainer::index<i_timestamp>::type::iterator entry =
-      m_seqTimeouts.get<i_timestamp>().begin();
-    if (entry->time + rto <= now) // timeout expired?
+  while (m_seqs.hasPendingTimeouts()) {
+    if (m_seqs.getEarliestTimeout().timeoutStart + rto <= now) // timeout expired?
     {
-      uint32_t seqNo = entry->seq;
-      m_seqTimeouts.get<i_timestamp>().erase(entry);
+      uint32_t seqNo = m_seqs.popEarliestTimeout();
       OnTimeout(seqNo);
     }
     else
       break; // nothing else to do. All later packets need not be retransmitted
   }
 
-  m_retxEvent = Simulator::Schedule(m_retxTimer, &Consumer::CheckRetxTimeout, this);
+  ScheduleRetxTimeout();
 }
 
 // Application Methods
@@ -165,10 +197,8 @@ Consumer::SendPacket()
 
   uint32_t seq = std::numeric_limits<uint32_t>::max(); // invalid
 
-  while (m_retxSeqs.size()) {
-    seq = *m_retxSeqs.begin();
-    m_retxSeqs.erase(m_retxSeqs.begin());
-    break;
+  if (m_seqs.hasPendingRetx()) {
+    seq = m_seqs.popRetx();
   }
 
   if (seq == std::numeric_limits<uint32_t>::max()) {
@@ -181,17 +211,8 @@ Consumer::SendPacket()
     seq = m_seq++;
   }
 
-  //
-  shared_ptr<Name> nameWithSequence = make_shared<Name>(m_interestName);
-  nameWithSequence->appendSequenceNumber(seq);
-  //
-
-  // shared_ptr<Interest> interest = make_shared<Interest> ();
-  shared_ptr<Interest> interest = make_shared<Interest>();
-  interest->setNonce(m_rand->GetValue(0, std::numeric_limits<uint32_t>::max()));
-  interest->setName(*nameWithSequence);
-  time::milliseconds interestLifeTime(m_interestLifeTime.GetMilliSeconds());
-  interest->setInterestLifetime(interestLifeTime);
+  shared_ptr<Interest> interest =
+    m_interestFactory.start(m_interestName).appendSequenceNumber(seq).build(m_interestLifeTime);
 
   // NS_LOG_INFO ("Requesting Interest: \n" << *interest);
   NS_LOG_INFO("> Interest for " << seq);
@@ -231,24 +252,21 @@ Consumer::OnData(shared_ptr<const Data> data)
   }
   NS_LOG_DEBUG("Hop count: " << hopCount);
 
-  SeqTimeoutsContainer::iterator entry = m_seqLastDelay.find(seq);
-  if (entry != m_seqLastDelay.end()) {
-    m_lastRetransmittedInterestDataDelay(this, seq, Simulator::Now() - entry->time, hopCount);
-  }
+  SeqStateTable::Entry* entry = m_seqs.find(seq);
+  if (entry != nullptr) {
+    // copy, as trace sinks may send new Interests
+    SeqStateTable::Entry state = *entry;
+    m_seqs.erase(seq);
 
-  entry = m_seqFullDelay.find(seq);
-  if (entry != m_seqFullDelay.end()) {
-    m_firstInterestDataDelay(this, seq, Simulator::Now() - entry->time, m_seqRetxCounts[seq], hopCount);
+    m_lastRetransmittedInterestDataDelay(this, seq, Simulator::Now() - state.lastSent, hopCount);
+    m_firstInterestDataDelay(this, seq, Simulator::Now() - state.firstSent, state.retxCount,
+                             hopCount);
   }
 
-  m_seqRetxCounts.erase(seq);
-  m_seqFullDelay.erase(seq);
-  m_seqLastDelay.erase(seq);
-
-  m_seqTimeouts.erase(seq);
-  m_retxSeqs.erase(seq);
-
   m_rtt->AckSeq(SequenceNumber32(seq));
+
+  // RTO may have decreased
+  ScheduleRetxTimeout();
 }
 
 void
@@ -271,25 +289,28 @@ Consumer::OnTimeout(uint32_t sequenceNumber)
   m_rtt->IncreaseMultiplier(); // Double the next RTO
   m_rtt->SentSeq(SequenceNumber32(sequenceNumber),
                  1); // make sure to disable RTT calculation for this sample
-  m_retxSeqs.insert(sequenceNumber);
+  m_seqs.scheduleRetx(sequenceNumber);
   ScheduleNextPacket();
 }
 
+bool
+Consumer::IsCongestionMarked(const Data& data)
+{
+  auto congestionMarkTag = data.getTag<lp::CongestionMarkTag>();
+  return congestionMarkTag != nullptr && *congestionMarkTag > 0;
+}
+
 void
 Consumer::WillSendOutInterest(uint32_t sequenceNumber)
 {
   NS_LOG_DEBUG("Trying to add " << sequenceNumber << " with " << Simulator::Now() << ". already "
-                                << m_seqTimeouts.size() << " items");
+                                << m_seqs.getNPendingTimeouts() << " items");
 
-  m_seqTimeouts.insert(SeqTimeout(sequenceNumber, Simulator::Now()));
-  m_seqFullDelay.insert(SeqTimeout(sequenceNumber, Simulator::Now()));
-
-  m_seqLastDelay.erase(sequenceNumber);
-  m_seqLastDelay.insert(SeqTimeout(sequenceNumber, Simulator::Now()));
-
-  m_seqRetxCounts[sequenceNumber]++;
+  m_seqs.onSent(sequenceNumber, Simulator::Now());
 
   m_rtt->SentSeq(SequenceNumber32(sequenceNumber), 1);
+
+  ScheduleRetxTimeout();
 }
 
 } // namespace ndn
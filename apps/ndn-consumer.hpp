@@ -30,14 +30,8 @@
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 #include "ns3/ndnSIM/utils/ndn-rtt-estimator.hpp"
-
-#include <set>
-#include <map>
-
-#include <boost/multi_index_container.hpp>
-#include <boost/multi_index/tag.hpp>
-#include <boost/multi_index/ordered_index.hpp>
-#include <boost/multi_index/member.hpp>
+#include "ns3/ndnSIM/utils/ndn-seq-state-table.hpp"
+#include "ns3/ndnSIM/utils/ndn-interest-factory.hpp"
 
 namespace ns3 {
 namespace ndn {
@@ -92,6 +86,12 @@ public:
   virtual void
   WillSendOutInterest(uint32_t sequenceNumber);
 
+  /**
+   * @brief Check whether @p data carries a congestion mark (NDNLP CongestionMark field)
+   */
+  static bool
+  IsCongestionMarked(const Data& data);
+
 public:
   typedef void (*LastRetransmittedInterestDataDelayCallback)(Ptr<App> app, uint32_t seqno, Time delay, int32_t hopCount);
   typedef void (*FirstInterestDataDelayCallback)(Ptr<App> app, uint32_t seqno, Time delay, uint32_t retxCount, int32_t hopCount);
@@ -118,27 +118,40 @@ protected:
   CheckRetxTimeout();
 
   /**
-   * \brief Modifies the frequency of checking the retransmission timeouts
-   * \param retxTimer Timeout defining how frequent retransmission timeouts should be checked
+   * \brief Arms the retransmission timer for the earliest outstanding deadline
+   *
+   * The timer is re-armed only if the earliest deadline moved before the currently armed
+   * time (e.g., RTO decreased).  If the deadline moved later, the armed timer fires early,
+   * finds nothing expired and re-arms itself.  Must be called after SeqStateTable::onSent
+   * or after updating m_rtt.
+   */
+  void
+  ScheduleRetxTimeout();
+
+  /**
+   * \brief Modifies the granularity of retransmission timeout detection
+   * \param retxTimer Granularity with which retransmission timeouts are detected
    */
   void
   SetRetxTimer(Time retxTimer);
 
   /**
-   * \brief Returns the frequency of checking the retransmission timeouts
-   * \return Timeout defining how frequent retransmission timeouts should be checked
+   * \brief Returns the granularity of retransmission timeout detection
+   * \return Granularity with which retransmission timeouts are detected
    */
   Time
   GetRetxTimer() const;
 
 protected:
   Ptr<UniformRandomVariable> m_rand; ///< @brief nonce generator
+  InterestFactory m_interestFactory; ///< @brief constructs Interests with nonces from m_rand
 
-  uint32_t m_seq;      ///< @brief currently requested sequence number
-  uint32_t m_seqMax;   ///< @brief maximum number of sequence number
-  EventId m_sendEvent; ///< @brief EventId of pending "send packet" event
-  Time m_retxTimer;    ///< @brief Currently estimated retransmission timer
-  EventId m_retxEvent; ///< @brief Event to check whether or not retransmission should be performed
+  uint32_t m_seq;        ///< @brief currently requested sequence number
+  uint32_t m_seqMax;     ///< @brief maximum number of sequence number
+  EventId m_sendEvent;   ///< @brief EventId of pending "send packet" event
+  Time m_retxTimer;      ///< @brief Granularity of retransmission timeout detection
+  Time m_retxTimerStart; ///< @brief Time from which RetxTimer granularity is counted
+  EventId m_retxEvent;   ///< @brief Event armed for the earliest retransmission deadline
 
   Ptr<RttEstimator> m_rtt; ///< @brief RTT estimator
 
@@ -147,62 +160,7 @@ protected:
   Time m_interestLifeTime; ///< \brief LifeTime for interest packet
 
   /// @cond include_hidden
-  /**
-   * \struct This struct contains sequence numbers of packets to be retransmitted
-   */
-  struct RetxSeqsContainer : public std::set<uint32_t> {
-  };
-
-  RetxSeqsContainer m_retxSeqs; ///< \brief ordered set of sequence numbers to be retransmitted
-
-  /**
-   * \struct This struct contains a pair of packet sequence number and its timeout
-   */
-  struct SeqTimeout {
-    SeqTimeout(uint32_t _seq, Time _time)
-      : seq(_seq)
-      , time(_time)
-    {
-    }
-
-    uint32_t seq;
-    Time time;
-  };
-  /// @endcond
-
-  /// @cond include_hidden
-  class i_seq {
-  };
-  class i_timestamp {
-  };
-  /// @endcond
-
-  /// @cond include_hidden
-  /**
-   * \struct This struct contains a multi-index for the set of SeqTimeout structs
-   */
-  struct SeqTimeoutsContainer
-    : public boost::multi_index::
-        multi_index_container<SeqTimeout,
-                              boost::multi_index::
-                                indexed_by<boost::multi_index::
-                                             ordered_unique<boost::multi_index::tag<i_seq>,
-                                                            boost::multi_index::
-                                                              member<SeqTimeout, uint32_t,
-                                                                     &SeqTimeout::seq>>,
-                                           boost::multi_index::
-                                             ordered_non_unique<boost::multi_index::
-                                                                  tag<i_timestamp>,
-                                                                boost::multi_index::
-                                                                  member<SeqTimeout, Time,
-                                                                         &SeqTimeout::time>>>> {
-  };
-
-  SeqTimeoutsContainer m_seqTimeouts; ///< \brief multi-index for the set of SeqTimeout structs
-
-  SeqTimeoutsContainer m_seqLastDelay;
-  SeqTimeoutsContainer m_seqFullDelay;
-  std::map<uint32_t, uint32_t> m_seqRetxCounts;
+  SeqStateTable m_seqs; ///< \brief send times, timeouts and retransmissions of sequence numbers
 
   TracedCallback<Ptr<App> /* app */, uint32_t /* seqno */, Time /* delay */, int32_t /*hop count*/>
     m_lastRetransmittedInterestDataDelay;
@@ -24,10 +24,12 @@
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
 #include "ns3/boolean.h"
+#include "ns3/double.h"
 
 #include "model/ndn-l3-protocol.hpp"
 #include "helper/ndn-fib-helper.hpp"
 
+#include <cmath>
 #include <memory>
 
 NS_LOG_COMPONENT_DEFINE("ndn.ProducerRtc");
@@ -58,6 +60,27 @@ ProducerRtc::GetTypeId(void)
       .AddAttribute("SegmentsPerKeyFrame", "Segments per key frame", UintegerValue(30),
                     MakeUintegerAccessor(&ProducerRtc::m_segmentsPerKeyFrame),
                     MakeUintegerChecker<uint32_t>())
+      .AddAttribute("FecRatio",
+                    "Number of FEC parity segments per frame, relative to the number of data "
+                    "segments (rounded up). If 0, no parity segments are published",
+                    DoubleValue(0), MakeDoubleAccessor(&ProducerRtc::m_fecRatio),
+                    MakeDoubleChecker<double>(0))
+      .AddAttribute("BundleSegments",
+                    "Also publish every frame as a single Data named after the frame, which "
+                    "carries all data segments and is fragmented by NDNLP on every link",
+                    BooleanValue(false), MakeBooleanAccessor(&ProducerRtc::m_bundleSegments),
+                    MakeBooleanChecker())
+      .AddAttribute("NumLayers",
+                    "Number of SVC layers of every frame (base layer and NumLayers-1 "
+                    "enhancement layers). Segments of enhancement layer l are published under "
+                    "<frame>/layer/<l>",
+                    UintegerValue(1), MakeUintegerAccessor(&ProducerRtc::m_nLayers),
+                    MakeUintegerChecker<uint32_t>(1))
+      .AddAttribute("EnhancementSegmentsRatio",
+                    "Number of segments of each enhancement layer, relative to the number of "
+                    "segments of the base layer (rounded up)",
+                    DoubleValue(1.0), MakeDoubleAccessor(&ProducerRtc::m_enhancementSegmentsRatio),
+                    MakeDoubleChecker<double>(0))
       .AddAttribute(
          "Postfix",
          "Postfix that is added to the output data (e.g., for adding producer-uniqueness)",
@@ -107,7 +130,9 @@ ProducerRtc::StartApplication()
   NS_LOG_INFO("Sampling Rate: " << m_samplingRate);
   NS_LOG_INFO("Sampling Period: " << m_samplePeriod);
   NS_LOG_INFO("Freshness Period: " << m_freshness.GetSeconds());
-  FibHelper::AddRoute(GetNode(), Name(m_conferencePrefix.toUri() + m_producerPrefix.toUri()), m_face, 0);
+  m_namespace = RtcNamespace(Name(m_conferencePrefix).append(m_producerPrefix));
+  m_frameRegistry = RtcFrameRegistry::getRegistry(m_namespace.getStreamPrefix());
+  FibHelper::AddRoute(GetNode(), m_namespace.getStreamPrefix(), m_face, 0);
   FibHelper::AddRoute(GetNode(), m_conferencePrefix, m_face, 0);
   Simulator::Schedule(Seconds(m_samplePeriod), &ProducerRtc::GenerateFrame, this);
 }
@@ -126,14 +151,12 @@ Name
 ProducerRtc::GenerateKeyFrame()
 {
   m_keyFrameId++;
-  Name frameName = Name(m_conferencePrefix.toUri() + m_producerPrefix.toUri());
-  frameName.append("key");
-
-  frameName.appendSequenceNumber(m_keyFrameId);
+  Name frameName = m_namespace.getKeyFrameName(m_keyFrameId);
 
   m_deltaFrameId = 0;
 
   NS_LOG_INFO("Generating Key Frame: " << frameName);
+  m_latestKeyFrame = frameName;
 
   Name tempFrameName = frameName;
 
@@ -144,6 +167,10 @@ ProducerRtc::GenerateKeyFrame()
     m_outputFile.flush();
     frameName = tempFrameName;
   }
+  GenerateParitySegments(tempFrameName, m_segmentsPerKeyFrame);
+  GenerateLayerSegments(tempFrameName, m_segmentsPerKeyFrame);
+  GenerateBundle(tempFrameName);
+  m_frameRegistry->recordFrame(tempFrameName, Simulator::Now(), m_segmentsPerKeyFrame);
 
   return tempFrameName;
 }
@@ -151,17 +178,12 @@ ProducerRtc::GenerateKeyFrame()
 Name
 ProducerRtc::GenerateDeltaFrame()
 {
-  Name frameName = Name(m_conferencePrefix.toUri() + m_producerPrefix.toUri());
-  frameName.append("delta");
-
-  frameName.appendSequenceNumber(m_deltaFrameId);
-
-  frameName.append("paired-key");
-  frameName.appendSequenceNumber(m_keyFrameId);
+  Name frameName = m_namespace.getDeltaFrameName(m_deltaFrameId, m_keyFrameId);
 
   m_deltaFrameId++;
 
   NS_LOG_INFO("Generating Delta Frame: " << frameName);
+  m_latestDeltaFrame = frameName;
 
   Name tempFrameName = frameName;
 
@@ -172,10 +194,86 @@ ProducerRtc::GenerateDeltaFrame()
     m_outputFile.flush();
     frameName = tempFrameName;
   }
+  GenerateParitySegments(tempFrameName, m_segmentsPerDeltaFrame);
+  GenerateLayerSegments(tempFrameName, m_segmentsPerDeltaFrame);
+  GenerateBundle(tempFrameName);
+  m_frameRegistry->recordFrame(tempFrameName, Simulator::Now(), m_segmentsPerDeltaFrame);
 
   return tempFrameName;
 }
 
+void
+ProducerRtc::GenerateParitySegments(const Name& frameName, uint32_t nSegments)
+{
+  // parity segments have the same (virtual) payload size as data segments, any nSegments of
+  // the data and parity segments are assumed to be sufficient to recover the frame
+  for (uint32_t i = 0; i < GetNParitySegments(nSegments); i++) {
+    Name parityName = RtcNamespace::getParityName(frameName, i);
+    m_framesGenerated.push_back(parityName);
+    m_outputFile << Simulator::Now().GetSeconds() << "," << parityName << "\n";
+  }
+  m_outputFile.flush();
+}
+
+uint32_t
+ProducerRtc::GetNParitySegments(uint32_t nSegments) const
+{
+  return static_cast<uint32_t>(std::ceil(m_fecRatio * nSegments));
+}
+
+void
+ProducerRtc::GenerateLayerSegments(const Name& frameName, uint32_t nSegments)
+{
+  // enhancement layers are neither protected by FEC nor bundled, a consumer fetches them
+  // segment by segment only when it has enough throughput to spare
+  for (uint32_t layer = 1; layer < m_nLayers; layer++) {
+    Name layerName = RtcNamespace::getLayerName(frameName, layer);
+    for (uint32_t i = 0; i < GetNLayerSegments(nSegments); i++) {
+      m_framesGenerated.push_back(Name(layerName).appendSequenceNumber(i));
+      m_outputFile << Simulator::Now().GetSeconds() << "," << m_framesGenerated.back() << "\n";
+    }
+  }
+  m_outputFile.flush();
+}
+
+uint32_t
+ProducerRtc::GetNLayerSegments(uint32_t nSegments) const
+{
+  return static_cast<uint32_t>(std::ceil(m_enhancementSegmentsRatio * nSegments));
+}
+
+void
+ProducerRtc::GenerateBundle(const Name& frameName)
+{
+  if (!m_bundleSegments) {
+    return;
+  }
+
+  m_framesGenerated.push_back(frameName);
+  m_outputFile << Simulator::Now().GetSeconds() << "," << frameName << "\n";
+  m_outputFile.flush();
+}
+
+uint32_t
+ProducerRtc::GetNPublishedNames(uint32_t nSegments) const
+{
+  return nSegments + GetNParitySegments(nSegments) + (m_bundleSegments ? 1 : 0)
+         + (m_nLayers - 1) * GetNLayerSegments(nSegments);
+}
+
+uint32_t
+ProducerRtc::GetPayloadSize(const Name& dataName) const
+{
+  RtcName parsed = m_namespace.parse(dataName);
+  if (!parsed.isFrame()) {
+    return m_virtualPayloadSize;
+  }
+  if (parsed.type == RTC_FRAME_KEY) {
+    return m_virtualPayloadSize * m_segmentsPerKeyFrame;
+  }
+  return m_virtualPayloadSize * m_segmentsPerDeltaFrame;
+}
+
 void
 ProducerRtc::GenerateFrame()
 {
@@ -193,6 +291,7 @@ ProducerRtc::GenerateFrame()
   }
 
   m_frameId++;
+  RefreshDiscoveryData();
 
   // make sure the queue does not get too long...
   // if (m_framesGenerated.size() > 1000) {
@@ -213,11 +312,11 @@ ProducerRtc::GenerateFrame()
       NS_LOG_INFO("Generated frame has been already requested, sending data packet out: " << *it);
       SendData(*it, m_freshness);
       if (key_frame) {
-        if (segments_found == m_segmentsPerKeyFrame)
+        if (segments_found == GetNPublishedNames(m_segmentsPerKeyFrame))
           break;
       }
       else {
-        if (segments_found == m_segmentsPerDeltaFrame)
+        if (segments_found == GetNPublishedNames(m_segmentsPerDeltaFrame))
           break;
       }
     }
@@ -242,53 +341,29 @@ ProducerRtc::OnInterest(shared_ptr<const Interest> interest)
   if (!m_active)
     return;
 
-  Name interestName = interest->getName();
+  const Name& interestName = interest->getName();
+  RtcName parsed = m_namespace.parse(interestName);
+  bool isExploration = m_namespace.isTypePrefix(interestName);
 
-  // Received Interest for exploration in delta namespace
-  if (interestName == Name(m_conferencePrefix.toUri() + m_producerPrefix.toUri() + "/delta") && interestName.size() == 3) {
-    Name frameToSend = m_framesGenerated.back();
-    for (auto it = m_framesGenerated.end() - 1; it != m_framesGenerated.begin(); it--) {
-      if (it->at(2).toUri() == "delta") {
-        frameToSend = it->getPrefix(-1);
-        frameToSend.appendSequenceNumber(0);
-        break;
-      }
+  // Interests for exploration are answered with Data pre-built when the last frame was generated
+  if (isExploration) {
+    shared_ptr<const Data> data;
+    if (parsed.type == RTC_FRAME_DELTA) {
+      data = m_latestDeltaData;
     }
-    NS_LOG_INFO("Interest for conference prefix in delta namespace. Sending out latest delta frame: " << frameToSend);
-    SendData(frameToSend, m_freshness);
-    return;
-  }
-
-  // Received Interest for exploration in key namespace
-  if (interestName == Name(m_conferencePrefix.toUri() + m_producerPrefix.toUri() + "/key") && interestName.size() == 3) {
-    Name frameToSend = m_framesGenerated.back();
-    for (auto it = m_framesGenerated.end() - 1; it != m_framesGenerated.begin(); it--) {
-      if (it->at(2).toUri() == "key") {
-        frameToSend = it->getPrefix(-1);
-        frameToSend.appendSequenceNumber(0);
-        frameToSend.appendSequenceNumber(m_deltaFrameId);
-        break;
-      }
+    else if (parsed.type == RTC_FRAME_KEY) {
+      data = m_latestKeyData;
+    }
+    else {
+      data = m_latestDiscoveryData;
     }
-    NS_LOG_INFO("Interest for conference prefix in key namespace. Sending out latest key frame: " << frameToSend);
-    SendData(frameToSend, m_freshness);
-    return;
-  }
 
-  // Received Interest for exploration in key namespace
-  if (interestName == Name(m_conferencePrefix.toUri() + m_producerPrefix.toUri() + "/discovery") && interestName.size() == 3) {
-    Name frameToSend = m_framesGenerated.back();
-    for (auto it = m_framesGenerated.end() - 1; it != m_framesGenerated.begin(); it--) {
-      if (it->at(2).toUri() == "key") {
-        frameToSend = interestName;
-        frameToSend.appendSequenceNumber(it->at(3).toSequenceNumber());
-        frameToSend.appendSequenceNumber(m_deltaFrameId);
-        break;
-      }
+    if (data == nullptr) {
+      NS_LOG_INFO("No frame generated yet, ignoring Interest for exploration: " << interestName);
+      return;
     }
-    NS_LOG_INFO("Interest for conference prefix in discovery namespace. Sending out latest key frame: " << frameToSend);
-    Time t = MilliSeconds(90);
-    SendData(frameToSend, t);
+    NS_LOG_INFO("Interest for exploration, sending out latest frame: " << data->getName());
+    SendData(data);
     return;
   }
 
@@ -308,10 +383,10 @@ ProducerRtc::OnInterest(shared_ptr<const Interest> interest)
         SendData(interestName, m_freshness);
         return;
       }
-      if (interestName.at(2).toUri() == "key")
+      if (parsed.type == RTC_FRAME_KEY)
         SendData(interestName, m_freshness);
       else if (m_deltaFrameId == 0) {
-        if (interestName.at(3).toSequenceNumber() == 28)
+        if (parsed.deltaId == 28)
           SendData(interestName, m_freshness);
         else {
           NS_LOG_INFO("Data with 0 ms freshness");
@@ -319,7 +394,7 @@ ProducerRtc::OnInterest(shared_ptr<const Interest> interest)
           SendData(interestName, t);
         }
       }
-      else if ((m_deltaFrameId - 1) == interestName.at(3).toSequenceNumber())
+      else if ((m_deltaFrameId - 1) == parsed.deltaId)
         SendData(interestName, m_freshness);
       else {
         NS_LOG_INFO("Data with 0 ms freshness");
@@ -336,14 +411,52 @@ ProducerRtc::OnInterest(shared_ptr<const Interest> interest)
 }
 
 void
-ProducerRtc::SendData(Name& dataName, Time freshness)
+ProducerRtc::RefreshDiscoveryData()
+{
+  // delta exploration: first segment of the latest delta frame (latest generated name, if
+  // only the first key frame has been generated so far)
+  Name deltaName = m_framesGenerated.back();
+  if (!m_latestDeltaFrame.empty()) {
+    deltaName = Name(m_latestDeltaFrame).appendSequenceNumber(0);
+  }
+  m_latestDeltaData = MakeData(deltaName, m_freshness);
+
+  // key exploration: first segment of the latest key frame, followed by the next delta number
+  m_latestKeyData = MakeData(Name(m_latestKeyFrame).appendSequenceNumber(0)
+                               .appendSequenceNumber(m_deltaFrameId),
+                             m_freshness);
+
+  // discovery: numbers of the latest key frame and the next delta frame
+  m_latestDiscoveryData = MakeData(Name(m_namespace.getDiscoveryName())
+                                     .appendSequenceNumber(m_keyFrameId)
+                                     .appendSequenceNumber(m_deltaFrameId),
+                                   MilliSeconds(90));
+}
+
+void
+ProducerRtc::SendData(const Name& dataName, Time freshness)
+{
+  SendData(MakeData(dataName, freshness));
+}
+
+void
+ProducerRtc::SendData(shared_ptr<const Data> data)
+{
+  NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Data: " << data->getName());
+
+  m_transmittedDatas(data, this, m_face);
+  m_appLink->onReceiveData(*data);
+}
+
+shared_ptr<Data>
+ProducerRtc::MakeData(const Name& dataName, Time freshness) const
 {
   auto data = make_shared<Data>();
   data->setName(dataName);
   data->setFreshnessPeriod(::ndn::time::milliseconds(freshness.GetMilliSeconds()));
   NS_LOG_INFO("Freshness: " << freshness.GetMilliSeconds() << " ms");
 
-  data->setContent(make_shared< ::ndn::Buffer>(m_virtualPayloadSize));
+  data->setContent(make_shared< ::ndn::Buffer>(GetPayloadSize(dataName)));
 
   Signature signature;
   SignatureInfo signatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255));
@@ -357,13 +470,10 @@ ProducerRtc::SendData(Name& dataName, Time freshness)
 
   data->setSignature(signature);
 
-  NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Data: " << data->getName());
-
   // to create real wire encoding
   data->wireEncode();
 
-  m_transmittedDatas(data, this, m_face);
-  m_appLink->onReceiveData(*data);
+  return data;
 }
 
 } // namespace ndn
@@ -24,6 +24,8 @@
 
 #include "ndn-app.hpp"
 #include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/utils/ndn-rtc-name.hpp"
+#include "ns3/ndnSIM/utils/ndn-rtc-frame-registry.hpp"
 
 #include "ns3/nstime.h"
 #include "ns3/ptr.h"
@@ -65,7 +67,26 @@ protected:
   GenerateFrame(); // Generate a frame
 
   void
-  SendData(Name& dataName, Time freshness); // Send generated frame data
+  SendData(const Name& dataName, Time freshness); // Send generated frame data
+
+  /**
+   * @brief Send already built Data @p data
+   */
+  void
+  SendData(shared_ptr<const Data> data);
+
+  /**
+   * @brief Build and sign Data @p dataName with freshness period @p freshness
+   */
+  shared_ptr<Data>
+  MakeData(const Name& dataName, Time freshness) const;
+
+  /**
+   * @brief Rebuild Data answering exploration Interests for <stream>/delta, <stream>/key, and
+   * <stream>/discovery after a frame has been generated
+   */
+  void
+  RefreshDiscoveryData();
 
 private:
 
@@ -75,9 +96,56 @@ private:
   Name
   GenerateDeltaFrame(); // Generate a delta frame
 
+  /**
+   * @brief Publish FEC parity segments of frame @p frameName that has @p nSegments segments
+   */
+  void
+  GenerateParitySegments(const Name& frameName, uint32_t nSegments);
+
+  /**
+   * @brief Get number of FEC parity segments of a frame with @p nSegments data segments
+   */
+  uint32_t
+  GetNParitySegments(uint32_t nSegments) const;
+
+  /**
+   * @brief Publish segments of SVC enhancement layers of frame @p frameName whose base layer
+   * has @p nSegments segments
+   */
+  void
+  GenerateLayerSegments(const Name& frameName, uint32_t nSegments);
+
+  /**
+   * @brief Get number of segments of each SVC enhancement layer of a frame whose base layer
+   * has @p nSegments segments
+   */
+  uint32_t
+  GetNLayerSegments(uint32_t nSegments) const;
+
+  /**
+   * @brief Publish bundle of all data segments of frame @p frameName, if BundleSegments is set
+   */
+  void
+  GenerateBundle(const Name& frameName);
+
+  /**
+   * @brief Get number of names (segments, parity segments, bundle, and enhancement layer
+   * segments) published for a frame with @p nSegments data segments
+   */
+  uint32_t
+  GetNPublishedNames(uint32_t nSegments) const;
+
+  /**
+   * @brief Get virtual payload size of Data @p dataName (size of all segments for bundles)
+   */
+  uint32_t
+  GetPayloadSize(const Name& dataName) const;
+
 private:
   Name m_conferencePrefix;
   Name m_producerPrefix;
+  RtcNamespace m_namespace; ///< @brief names of conference prefix + producer prefix stream
+  shared_ptr<RtcFrameRegistry> m_frameRegistry; ///< @brief generation times for consumers
   Name m_postfix;
   uint32_t m_virtualPayloadSize;
   Time m_freshness;
@@ -95,8 +163,18 @@ private:
   uint64_t m_keyFrameId;
   uint64_t m_deltaFrameId;
 
+  Name m_latestKeyFrame;   ///< @brief name of the last generated key frame
+  Name m_latestDeltaFrame; ///< @brief name of the last generated delta frame, if any
+  shared_ptr<const Data> m_latestDeltaData;     ///< @brief answer to <stream>/delta
+  shared_ptr<const Data> m_latestKeyData;       ///< @brief answer to <stream>/key
+  shared_ptr<const Data> m_latestDiscoveryData; ///< @brief answer to <stream>/discovery
+
   uint32_t m_segmentsPerDeltaFrame;
   uint32_t m_segmentsPerKeyFrame;
+  double m_fecRatio;
+  bool m_bundleSegments;
+  uint32_t m_nLayers;
+  double m_enhancementSegmentsRatio;
 
   bool m_tweakFreshness;
 };
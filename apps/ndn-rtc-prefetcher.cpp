@@ -0,0 +1,214 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-rtc-prefetcher.hpp"
+
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+#include "ns3/boolean.h"
+
+#include "model/ndn-l3-protocol.hpp"
+
+#include <algorithm>
+
+NS_LOG_COMPONENT_DEFINE("ndn.RtcPrefetcher");
+
+namespace ns3 {
+namespace ndn {
+
+NS_OBJECT_ENSURE_REGISTERED(RtcPrefetcher);
+
+TypeId
+RtcPrefetcher::GetTypeId()
+{
+  static TypeId tid =
+    TypeId("ns3::ndn::RtcPrefetcher")
+      .SetGroupName("Ndn")
+      .SetParent<App>()
+      .AddConstructor<RtcPrefetcher>()
+
+      .AddAttribute("Prefix", "Prefix of RTC streams to prefetch (e.g., conference prefix)",
+                    StringValue("/"), MakeNameAccessor(&RtcPrefetcher::m_prefix),
+                    MakeNameChecker())
+
+      .AddAttribute("SamplingRate", "Sampling Rate (frames per second) of the streams",
+                    UintegerValue(30), MakeUintegerAccessor(&RtcPrefetcher::m_samplingRate),
+                    MakeUintegerChecker<uint32_t>(2))
+
+      .AddAttribute("SegmentsPerDeltaFrame", "Segments per delta frame", UintegerValue(5),
+                    MakeUintegerAccessor(&RtcPrefetcher::m_segmentsPerDeltaFrame),
+                    MakeUintegerChecker<uint32_t>())
+
+      .AddAttribute("SegmentsPerKeyFrame", "Segments per key frame", UintegerValue(30),
+                    MakeUintegerAccessor(&RtcPrefetcher::m_segmentsPerKeyFrame),
+                    MakeUintegerChecker<uint32_t>())
+
+      .AddAttribute("BundleSegments",
+                    "Prefetch every frame with a single Interest for the bundle of all its "
+                    "segments (requires BundleSegments of the producers)",
+                    BooleanValue(false), MakeBooleanAccessor(&RtcPrefetcher::m_bundleSegments),
+                    MakeBooleanChecker())
+
+      .AddAttribute("Depth", "Number of frames to prefetch ahead of the latest requested frame",
+                    UintegerValue(10), MakeUintegerAccessor(&RtcPrefetcher::m_depth),
+                    MakeUintegerChecker<uint32_t>())
+
+      .AddAttribute("LifeTime", "LifeTime for prefetch Interest packets", StringValue("2s"),
+                    MakeTimeAccessor(&RtcPrefetcher::m_interestLifeTime), MakeTimeChecker())
+
+      .AddTraceSource("FramePrefetched", "Interests for all segments of a frame have been sent",
+                      MakeTraceSourceAccessor(&RtcPrefetcher::m_framePrefetched),
+                      "ns3::ndn::RtcPrefetcher::FrameCallback");
+
+  return tid;
+}
+
+RtcPrefetcher::RtcPrefetcher()
+  : m_rand(CreateObject<UniformRandomVariable>())
+  , m_interestFactory(m_rand)
+{
+  NS_LOG_FUNCTION_NOARGS();
+}
+
+void
+RtcPrefetcher::StartApplication()
+{
+  NS_LOG_FUNCTION_NOARGS();
+  App::StartApplication();
+
+  GetNode()->GetObject<L3Protocol>()->TraceConnectWithoutContext(
+    "InInterests", MakeCallback(&RtcPrefetcher::OnRouterInterest, this));
+}
+
+void
+RtcPrefetcher::StopApplication()
+{
+  NS_LOG_FUNCTION_NOARGS();
+
+  GetNode()->GetObject<L3Protocol>()->TraceDisconnectWithoutContext(
+    "InInterests", MakeCallback(&RtcPrefetcher::OnRouterInterest, this));
+
+  App::StopApplication();
+}
+
+void
+RtcPrefetcher::OnData(shared_ptr<const Data> data)
+{
+  App::OnData(data); // tracing inside
+
+  // Data has been cached by the router on the way to the app, nothing else to do
+  NS_LOG_DEBUG("< Prefetched " << data->getName());
+}
+
+void
+RtcPrefetcher::OnRouterInterest(const Interest& interest, const Face& face)
+{
+  if (!m_active || face.getId() == m_face->getId()) {
+    return;
+  }
+
+  const Name& name = interest.getName();
+  if (!m_prefix.isPrefixOf(name)) {
+    return;
+  }
+
+  // the stream prefix is everything before the frame type component
+  size_t typeIndex = m_prefix.size();
+  for (; typeIndex < name.size(); typeIndex++) {
+    RtcFrameType type = RtcNamespace::getFrameType(name[typeIndex]);
+    if (type == RTC_FRAME_KEY || type == RTC_FRAME_DELTA) {
+      break;
+    }
+  }
+  if (typeIndex == name.size()) {
+    return;
+  }
+
+  Name streamPrefix = name.getPrefix(typeIndex);
+  auto stream = m_streams.find(streamPrefix);
+  if (stream == m_streams.end()) {
+    stream = m_streams.insert({streamPrefix, Stream{RtcNamespace(streamPrefix), 0}}).first;
+  }
+
+  RtcName parsed = stream->second.ns.parse(name);
+  bool isFrameName = parsed.keyId != RtcName::NONE
+                     && (parsed.type == RTC_FRAME_KEY || parsed.deltaId != RtcName::NONE);
+  if (!isFrameName || (!parsed.hasSegment() && !parsed.hasParity() && !parsed.isFrame())) {
+    return;
+  }
+
+  uint64_t position = GetFramePosition(parsed);
+  uint64_t first = std::max(position + 1, stream->second.nextPosition);
+  uint64_t last = position + m_depth;
+  if (first > last) {
+    return;
+  }
+  stream->second.nextPosition = last + 1;
+
+  // do not re-enter the forwarder while it is processing the downstream Interest
+  Simulator::ScheduleNow(&RtcPrefetcher::PrefetchFrames, this, streamPrefix, first, last);
+}
+
+void
+RtcPrefetcher::PrefetchFrames(Name streamPrefix, uint64_t first, uint64_t last)
+{
+  if (!m_active) {
+    return;
+  }
+
+  const RtcNamespace& ns = m_streams[streamPrefix].ns;
+  for (uint64_t position = first; position <= last; position++) {
+    uint64_t keyId = position / m_samplingRate;
+    uint64_t offset = position % m_samplingRate;
+    Name frameName =
+      offset == 0 ? ns.getKeyFrameName(keyId) : ns.getDeltaFrameName(offset - 1, keyId);
+
+    NS_LOG_INFO("> Prefetching frame " << frameName);
+    if (m_bundleSegments) {
+      shared_ptr<Interest> interest = m_interestFactory.build(frameName, m_interestLifeTime);
+      interest->setMaxSuffixComponents(1);
+      m_transmittedInterests(interest, this, m_face);
+      m_appLink->onReceiveInterest(*interest);
+    }
+    else {
+      uint32_t nSegments = offset == 0 ? m_segmentsPerKeyFrame : m_segmentsPerDeltaFrame;
+      for (uint32_t i = 0; i < nSegments; i++) {
+        shared_ptr<Interest> interest =
+          m_interestFactory.start(frameName).appendSequenceNumber(i).build(m_interestLifeTime);
+        m_transmittedInterests(interest, this, m_face);
+        m_appLink->onReceiveInterest(*interest);
+      }
+    }
+    m_framePrefetched(frameName);
+  }
+}
+
+uint64_t
+RtcPrefetcher::GetFramePosition(const RtcName& name) const
+{
+  if (name.type == RTC_FRAME_KEY) {
+    return name.keyId * m_samplingRate;
+  }
+  return name.keyId * m_samplingRate + name.deltaId + 1;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,120 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_RTC_PREFETCHER_H
+#define NDN_RTC_PREFETCHER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ndn-app.hpp"
+#include "ns3/ndnSIM/utils/ndn-interest-factory.hpp"
+#include "ns3/ndnSIM/utils/ndn-rtc-name.hpp"
+
+#include "ns3/nstime.h"
+#include "ns3/ptr.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/traced-callback.h"
+
+#include <map>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief Prefetcher of upcoming RTC frames into the Content Store of an (edge) router
+ *
+ * The app is installed on a router (e.g., with AppHelper) and watches Interests that the
+ * router receives from other faces.  When a downstream consumer requests a segment of a key or
+ * delta frame of an RTC stream under Prefix, the app requests all segments of the next Depth
+ * frames of the stream (only frames not requested by it before), once on behalf of all
+ * downstream consumers.  The Interests wait at the producer until the frames are generated;
+ * returning Data is cached by the router on the way to the app, so that later requests of
+ * downstream consumers are satisfied from the Content Store, and concurrent ones are
+ * aggregated in the PIT.
+ *
+ * Frame numbering follows ProducerRtc: every key frame is followed by SamplingRate-1 delta
+ * frames paired with it.  SamplingRate, SegmentsPerKeyFrame, SegmentsPerDeltaFrame, and
+ * BundleSegments must match the producers of the prefetched streams.
+ */
+class RtcPrefetcher : public App {
+public:
+  static TypeId
+  GetTypeId();
+
+  RtcPrefetcher();
+
+  virtual void
+  OnData(shared_ptr<const Data> data);
+
+  typedef void (*FrameCallback)(const Name& frame);
+
+protected:
+  virtual void
+  StartApplication();
+
+  virtual void
+  StopApplication();
+
+private:
+  /**
+   * @brief Notification about Interest @p interest received by the router from @p face
+   */
+  void
+  OnRouterInterest(const Interest& interest, const Face& face);
+
+  /**
+   * @brief Request frames [@p first, @p last] (in generation order) of stream @p streamPrefix
+   */
+  void
+  PrefetchFrames(Name streamPrefix, uint64_t first, uint64_t last);
+
+  /**
+   * @brief Get position of frame @p name in generation order of the stream
+   */
+  uint64_t
+  GetFramePosition(const RtcName& name) const;
+
+private:
+  /// @brief Prefetching state of a single RTC stream
+  struct Stream {
+    RtcNamespace ns;
+    uint64_t nextPosition; ///< @brief first frame not yet prefetched
+  };
+
+  Name m_prefix;
+  uint32_t m_samplingRate;
+  uint32_t m_segmentsPerDeltaFrame;
+  uint32_t m_segmentsPerKeyFrame;
+  bool m_bundleSegments;
+  uint32_t m_depth;
+  Time m_interestLifeTime;
+
+  Ptr<UniformRandomVariable> m_rand; ///< @brief nonce generator
+  InterestFactory m_interestFactory;
+
+  std::map<Name, Stream> m_streams;
+
+  TracedCallback<const Name&> m_framePrefetched;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_RTC_PREFETCHER_H
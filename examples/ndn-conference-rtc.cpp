@@ -0,0 +1,148 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-conference-rtc.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include <fstream>
+
+namespace ns3 {
+
+/**
+ * This scenario simulates a conference of N participants connected to a single router:
+ *
+ *    (participant 0) ---+
+ *    (participant 1) ---+--- (router)
+ *          ...          |
+ *    (participant N-1) -+
+ *
+ * Every participant runs a ProducerRtc with prefix /conference/participant<i> and a single
+ * ConsumerRtcConference that subscribes to the streams of all other participants.  FIBs are
+ * populated using GlobalRoutingHelper.
+ *
+ * Latency of every completed frame is written to conference-latency.csv.
+ *
+ * To run scenario with 20 participants, use the following command:
+ *
+ *     ./waf --run="ndn-conference-rtc --participants=20"
+ */
+
+static std::ofstream g_latencyFile;
+
+static void
+FrameCompleted(std::string context, const ndn::Name& frame, Time latency)
+{
+  g_latencyFile << Simulator::Now().GetSeconds() << "," << context << ","
+                << latency.GetMilliSeconds() << "," << frame << "\n";
+}
+
+int
+main(int argc, char* argv[])
+{
+  // setting default parameters for PointToPoint links and channels
+  Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("100Mbps"));
+  Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+  Config::SetDefault("ns3::QueueBase::MaxPackets", UintegerValue(1000));
+
+  uint32_t nParticipants = 10;
+  double duration = 5.0;
+
+  // Read optional command-line parameters (e.g., enable visualizer with ./waf --run=<> --visualize
+  CommandLine cmd;
+  cmd.AddValue("participants", "Number of conference participants", nParticipants);
+  cmd.AddValue("duration", "Simulation time (seconds)", duration);
+  cmd.Parse(argc, argv);
+
+  // Creating nodes
+  Ptr<Node> router = CreateObject<Node>();
+  NodeContainer participants;
+  participants.Create(nParticipants);
+
+  PointToPointHelper p2p;
+  for (uint32_t i = 0; i < nParticipants; i++) {
+    p2p.Install(participants.Get(i), router);
+  }
+
+  // Install NDN stack on all nodes
+  ndn::StackHelper ndnHelper;
+  ndnHelper.setCsSize(10000);
+  ndnHelper.InstallAll();
+
+  // Choosing forwarding strategy
+  ndn::StrategyChoiceHelper::InstallAll("/conference", "/localhost/nfd/strategy/best-route");
+
+  // Installing global routing interface on all nodes
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll();
+
+  // Installing applications
+  for (uint32_t i = 0; i < nParticipants; i++) {
+    std::string producerPrefix = "/participant" + std::to_string(i);
+
+    ndn::AppHelper producerHelper("ns3::ndn::ProducerRtc");
+    producerHelper.SetAttribute("ConferencePrefix", StringValue("/conference"));
+    producerHelper.SetAttribute("ProducerPrefix", StringValue(producerPrefix));
+    producerHelper.SetAttribute("PayloadSize", StringValue("1024"));
+    producerHelper.SetAttribute("Freshness", StringValue("1s"));
+    producerHelper.SetAttribute("Filename", StringValue("producer" + std::to_string(i) + ".csv"));
+    producerHelper.Install(participants.Get(i));
+    ndnGlobalRoutingHelper.AddOrigins("/conference" + producerPrefix, participants.Get(i));
+
+    std::string producers;
+    for (uint32_t j = 0; j < nParticipants; j++) {
+      if (j != i) {
+        producers += " /participant" + std::to_string(j);
+      }
+    }
+
+    ndn::AppHelper consumerHelper("ns3::ndn::ConsumerRtcConference");
+    consumerHelper.SetAttribute("ConferencePrefix", StringValue("/conference"));
+    consumerHelper.SetAttribute("Producers", StringValue(producers));
+    consumerHelper.SetAttribute("Filename", StringValue("consumer" + std::to_string(i) + ".csv"));
+    ApplicationContainer consumer = consumerHelper.Install(participants.Get(i));
+    consumer.Start(Seconds(1.0 + 0.01 * i));
+  }
+
+  // Calculate and install FIBs
+  ndn::GlobalRoutingHelper::CalculateRoutes();
+
+  g_latencyFile.open("conference-latency.csv");
+  g_latencyFile << "Time,Consumer,Latency,Frame Name\n";
+  Config::Connect("/NodeList/*/ApplicationList/*/$ns3::ndn::ConsumerRtcConference/FrameCompleted",
+                  MakeCallback(&FrameCompleted));
+
+  Simulator::Stop(Seconds(duration));
+
+  Simulator::Run();
+  Simulator::Destroy();
+
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::main(argc, argv);
+}
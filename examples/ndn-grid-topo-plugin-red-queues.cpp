@@ -44,15 +44,28 @@ namespace ns3 {
  * For every received interest, producer replies with a data packet, containing
  * 1024 bytes of virtual payload.
  *
+ * With --marking, routers add congestion marks to Data when the queuing delay on a link stays
+ * above 5ms for 100ms.  With --cc=<controller> (e.g., ns3::ndn::CongestionControlAimd), the
+ * consumer is ConsumerWindow with the given congestion controller, which reacts to the marks.
+ *
  * To run scenario and see what is happening, use the following command:
  *
  *     NS_LOG=ndn.Consumer:ndn.Producer ./waf --run=ndn-grid-topo-plugin
+ *
+ * or, with congestion marking:
+ *
+ *     ./waf --run="ndn-grid-topo-plugin-red-queues --marking=1 --cc=ns3::ndn::CongestionControlAimd"
  */
 
 int
 main(int argc, char* argv[])
 {
+  bool isMarkingEnabled = false;
+  std::string congestionControl;
+
   CommandLine cmd;
+  cmd.AddValue("marking", "Enable congestion marking on all links", isMarkingEnabled);
+  cmd.AddValue("cc", "Use ConsumerWindow with this congestion controller", congestionControl);
   cmd.Parse(argc, argv);
 
   AnnotatedTopologyReader topologyReader("", 25);
@@ -61,6 +74,9 @@ main(int argc, char* argv[])
 
   // Install NDN stack on all nodes
   ndn::StackHelper ndnHelper;
+  if (isMarkingEnabled) {
+    ndnHelper.SetCongestionMarking();
+  }
   ndnHelper.InstallAll();
 
   ndn::StrategyChoiceHelper::InstallAll("/", "ndn:/localhost/nfd/strategy/best-route");
@@ -77,10 +93,18 @@ main(int argc, char* argv[])
   // Install NDN applications
   std::string prefix = "/prefix";
 
-  ndn::AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
-  consumerHelper.SetPrefix(prefix);
-  consumerHelper.SetAttribute("Frequency", StringValue("100")); // 100 interests a second
-  consumerHelper.Install(consumerNodes);
+  if (congestionControl.empty()) {
+    ndn::AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+    consumerHelper.SetPrefix(prefix);
+    consumerHelper.SetAttribute("Frequency", StringValue("100")); // 100 interests a second
+    consumerHelper.Install(consumerNodes);
+  }
+  else {
+    ndn::AppHelper consumerHelper("ns3::ndn::ConsumerWindow");
+    consumerHelper.SetPrefix(prefix);
+    consumerHelper.SetAttribute("CongestionControl", StringValue(congestionControl));
+    consumerHelper.Install(consumerNodes);
+  }
 
   ndn::AppHelper producerHelper("ns3::ndn::Producer");
   producerHelper.SetPrefix(prefix);
@@ -45,14 +45,23 @@ main(int argc, char* argv[])
   uint32_t fresh_data_num = 1;
   uint32_t sampling_rate = 30;
   double random_number_range = 0.95;
+  double fec_ratio = 0;
+  bool adaptive_fec = false;
 
   // Read optional command-line parameters (e.g., enable visualizer with ./waf --run=<> --visualize
   CommandLine cmd;
 	cmd.AddValue("freshness", "Freshness of producer data", freshness);
 	cmd.AddValue("fresh-data-num", "Number of fresh data packets to be retrieved", fresh_data_num);
   cmd.AddValue("rate", "Sampling Rate", sampling_rate);
+  cmd.AddValue("fec", "FEC parity segments per data segment (0 to disable FEC)", fec_ratio);
+  cmd.AddValue("adaptive-fec", "Request parity segments according to observed loss", adaptive_fec);
   cmd.Parse(argc, argv);
 
+  // the same FEC ratio for the producer and all consumers
+  Config::SetDefault("ns3::ndn::ProducerRtc::FecRatio", DoubleValue(fec_ratio));
+  Config::SetDefault("ns3::ndn::ConsumerRtc::FecRatio", DoubleValue(fec_ratio));
+  Config::SetDefault("ns3::ndn::ConsumerRtc::AdaptiveFec", BooleanValue(adaptive_fec));
+
   // Creating nodes
   NodeContainer nodes;
   nodes.Create(15);
@@ -24,10 +24,36 @@
 #include "ns3/point-to-point-module.h"
 #include "ns3/ndnSIM-module.h"
 
+#include <fstream>
 #include <random>
 
 namespace ns3 {
 
+static std::ofstream g_frameLatencyFile;
+
+static std::ofstream g_lambdaFile;
+
+static void
+LambdaChanged(std::string context, uint32_t oldLambda, uint32_t newLambda)
+{
+  g_lambdaFile << Simulator::Now().GetSeconds() << "," << context << "," << newLambda << "\n";
+}
+
+static std::ofstream g_layersFile;
+
+static void
+LayersChanged(std::string context, uint32_t oldLayers, uint32_t newLayers)
+{
+  g_layersFile << Simulator::Now().GetSeconds() << "," << context << "," << newLayers << "\n";
+}
+
+static void
+FrameDisplayed(std::string context, const ndn::Name& frame, Time latency)
+{
+  g_frameLatencyFile << Simulator::Now().GetSeconds() << "," << context << ","
+                     << latency.GetMilliSeconds() << "," << frame << "\n";
+}
+
 int
 main(int argc, char* argv[])
 {
@@ -42,6 +68,13 @@ main(int argc, char* argv[])
   double random_number_range = 1.00;
   double rtt = 80;
   bool force_to_retrieve_old_data = false;
+  bool bundle = false;
+  std::string pipelineControl = "ns3::ndn::RtcPipelineControlEwma";
+  uint32_t layers = 1;
+  std::string slowLeafRate = "";
+  bool prefetch = false;
+  bool rtcCs = false;
+  std::string backgroundRate = "";
 
   // Read optional command-line parameters (e.g., enable visualizer with ./waf --run=<> --visualize
   CommandLine cmd;
@@ -49,8 +82,29 @@ main(int argc, char* argv[])
 	cmd.AddValue("fresh-data-num", "Number of fresh data packets to be retrieved", fresh_data_num);
   cmd.AddValue("rate", "Sampling Rate", sampling_rate);
   cmd.AddValue("random-number-range", "Random Number Range", random_number_range);
+  cmd.AddValue("bundle", "Fetch every frame with a single Interest instead of one per segment",
+               bundle);
+  cmd.AddValue("pipeline-control", "Controller of the consumer pipeline size (lambda)",
+               pipelineControl);
+  cmd.AddValue("layers", "Number of SVC layers published by the producer", layers);
+  cmd.AddValue("slow-leaf-rate",
+               "Data rate of the link to the last consumer (e.g., 2Mbps), to give consumers "
+               "heterogeneous bottlenecks",
+               slowLeafRate);
+  cmd.AddValue("prefetch", "Prefetch upcoming frames into the caches of the edge routers",
+               prefetch);
+  cmd.AddValue("rtc-cs", "Use RTC-aware replacement policy in Content Stores of all nodes", rtcCs);
+  cmd.AddValue("background-rate",
+               "Rate of fluid background traffic from the root to its children (e.g., 900Mbps)",
+               backgroundRate);
   cmd.Parse(argc, argv);
 
+  Config::SetDefault("ns3::ndn::ProducerRtc::BundleSegments", BooleanValue(bundle));
+  Config::SetDefault("ns3::ndn::ConsumerRtc::BundleSegments", BooleanValue(bundle));
+  Config::SetDefault("ns3::ndn::ConsumerRtc::PipelineControl", StringValue(pipelineControl));
+  Config::SetDefault("ns3::ndn::ProducerRtc::NumLayers", UintegerValue(layers));
+  Config::SetDefault("ns3::ndn::ConsumerRtc::NumLayers", UintegerValue(layers));
+
   // Creating nodes
   NodeContainer nodes;
   nodes.Create(7);
@@ -62,14 +116,29 @@ main(int argc, char* argv[])
   p2p.Install(nodes.Get(1), nodes.Get(3));
   p2p.Install(nodes.Get(1), nodes.Get(4));
   p2p.Install(nodes.Get(2), nodes.Get(5));
+  if (!slowLeafRate.empty()) {
+    p2p.SetDeviceAttribute("DataRate", StringValue(slowLeafRate));
+  }
   p2p.Install(nodes.Get(2), nodes.Get(6));
 
   // Install NDN stack on all nodes
   ndn::StackHelper ndnHelper;
   ndnHelper.setCsSize(100000);
+  if (rtcCs) {
+    ndnHelper.SetOldContentStore("ns3::ndn::cs::Rtc", "MaxSize", "100000");
+  }
   ndnHelper.SetDefaultRoutes(true);
   ndnHelper.InstallAll();
 
+  // Background load on the links from the root, modeled analytically instead of by
+  // packet-level ConsumerCbr/Producer pairs
+  if (!backgroundRate.empty()) {
+    ndn::FluidTrafficHelper::AddFlow(nodes.Get(0), nodes.Get(1), DataRate(backgroundRate),
+                                     Seconds(0), Seconds(5));
+    ndn::FluidTrafficHelper::AddFlow(nodes.Get(0), nodes.Get(2), DataRate(backgroundRate),
+                                     Seconds(0), Seconds(5));
+  }
+
   // Choosing forwarding strategy
   ndn::StrategyChoiceHelper::InstallAll("/conference", "/localhost/nfd/strategy/best-route");
   double startTime = 0.0;
@@ -174,9 +243,40 @@ main(int argc, char* argv[])
   producerHelper.SetAttribute("TweakFreshness", BooleanValue(true));
   producerHelper.Install(nodes.Get(0)); // install producer at the root of the tree
 
+  // Prefetchers at the routers the consumers are attached to
+  if (prefetch) {
+    ndn::AppHelper prefetcherHelper("ns3::ndn::RtcPrefetcher");
+    prefetcherHelper.SetAttribute("Prefix", StringValue("/conference"));
+    prefetcherHelper.SetAttribute("SamplingRate", StringValue(std::to_string(sampling_rate)));
+    prefetcherHelper.SetAttribute("BundleSegments", BooleanValue(bundle));
+    prefetcherHelper.Install(nodes.Get(1));
+    prefetcherHelper.Install(nodes.Get(2));
+  }
+
+  // capture-to-display latency of every frame displayed by every consumer
+  g_frameLatencyFile.open("frame-latency.csv");
+  g_frameLatencyFile << "Time,Consumer,Latency,Frame Name\n";
+  Config::Connect("/NodeList/*/ApplicationList/*/$ns3::ndn::ConsumerRtc/Playout/FrameDisplayed",
+                  MakeCallback(&FrameDisplayed));
+
+  g_lambdaFile.open("lambda.csv");
+  g_lambdaFile << "Time,Consumer,Lambda\n";
+  Config::Connect("/NodeList/*/ApplicationList/*/$ns3::ndn::ConsumerRtc/Lambda",
+                  MakeCallback(&LambdaChanged));
+
+  // number of SVC layers requested by every consumer
+  g_layersFile.open("layers.csv");
+  g_layersFile << "Time,Consumer,Layers\n";
+  Config::Connect("/NodeList/*/ApplicationList/*/$ns3::ndn::ConsumerRtc/Layers",
+                  MakeCallback(&LayersChanged));
+
+  // PIT sizes and per-face packet counters, to compare per-segment and bundled fetching
+  ndn::NetworkTracer::InstallAll("network-trace.bin", MilliSeconds(100));
+
   Simulator::Stop(Seconds(5));
 
   Simulator::Run();
+  ndn::NetworkTracer::Destroy();
   Simulator::Destroy();
 
   return 0;
@@ -39,6 +39,7 @@
 #include "ns3/data-rate.h"
 
 #include "daemon/mgmt/fib-manager.hpp"
+#include "daemon/fw/forwarder.hpp"
 #include "ns3/ndnSIM/model/ndn-l3-protocol.hpp"
 #include "ns3/ndnSIM/helper/ndn-stack-helper.hpp"
 
@@ -92,6 +93,13 @@ FibHelper::AddRoute(Ptr<Node> node, const Name& prefix, shared_ptr<Face> face, i
   // Get the forwarder instance
   shared_ptr<nfd::Forwarder> m_forwarder = L3protocol->getForwarder();
 
+  if (L3protocol->getFibManager() == nullptr) {
+    // FIB manager is disabled, update FIB directly
+    auto entry = m_forwarder->getFib().insert(prefix).first;
+    entry->addNextHop(*face, metric);
+    return;
+  }
+
   ControlParameters parameters;
   parameters.setName(prefix);
   parameters.setFaceId(face->getId());
@@ -182,6 +190,19 @@ FibHelper::RemoveRoute(Ptr<Node> node, const Name& prefix, shared_ptr<Face> face
   // Get the forwarder instance
   shared_ptr<nfd::Forwarder> m_forwarder = L3protocol->getForwarder();
 
+  if (L3protocol->getFibManager() == nullptr) {
+    // FIB manager is disabled, update FIB directly
+    nfd::Fib& fib = m_forwarder->getFib();
+    nfd::fib::Entry* entry = fib.findExactMatch(prefix);
+    if (entry != nullptr) {
+      entry->removeNextHop(*face);
+      if (!entry->hasNextHops()) {
+        fib.erase(*entry);
+      }
+    }
+    return;
+  }
+
   ControlParameters parameters;
   parameters.setName(prefix);
   parameters.setFaceId(face->getId());
@@ -0,0 +1,110 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-fluid-traffic-helper.hpp"
+
+#include "ns3/assert.h"
+#include "ns3/names.h"
+#include "ns3/point-to-point-net-device.h"
+#include "ns3/point-to-point-channel.h"
+#include "ns3/channel.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+
+#include "model/ndn-l3-protocol.hpp"
+#include "model/ndn-net-device-transport.hpp"
+#include "NFD/daemon/face/face.hpp"
+
+#include "fw/forwarder.hpp"
+
+NS_LOG_COMPONENT_DEFINE("ndn.FluidTrafficHelper");
+
+namespace ns3 {
+namespace ndn {
+
+void
+FluidTrafficHelper::AddFlow(Ptr<Node> from, Ptr<Node> to, DataRate rate, Time start, Time stop,
+                            uint32_t packetSize)
+{
+  NS_LOG_FUNCTION(from << to << rate << start << stop);
+
+  NS_ASSERT(from != nullptr && to != nullptr);
+  NS_ASSERT(Simulator::Now() <= start && start <= stop);
+
+  int64_t bitRate = static_cast<int64_t>(rate.GetBitRate());
+  Simulator::Schedule(start - Simulator::Now(), &FluidTrafficHelper::changeRate, from, to, bitRate,
+                      packetSize);
+  Simulator::Schedule(stop - Simulator::Now(), &FluidTrafficHelper::changeRate, from, to, -bitRate,
+                      packetSize);
+}
+
+void
+FluidTrafficHelper::AddFlowByName(const std::string& from, const std::string& to, DataRate rate,
+                                  Time start, Time stop, uint32_t packetSize)
+{
+  AddFlow(Names::Find<Node>(from), Names::Find<Node>(to), rate, start, stop, packetSize);
+}
+
+NetDeviceTransport*
+FluidTrafficHelper::findTransport(Ptr<Node> from, Ptr<Node> to)
+{
+  Ptr<ndn::L3Protocol> ndn = from->GetObject<ndn::L3Protocol>();
+  NS_ASSERT(ndn != nullptr);
+
+  // iterate over all faces to find the right one
+  for (const auto& face : ndn->getForwarder()->getFaceTable()) {
+    auto transport = dynamic_cast<NetDeviceTransport*>(face.getTransport());
+    if (transport == nullptr)
+      continue;
+
+    Ptr<PointToPointNetDevice> nd1 = transport->GetNetDevice()->GetObject<PointToPointNetDevice>();
+    if (nd1 == nullptr)
+      continue;
+
+    Ptr<PointToPointChannel> ppChannel = DynamicCast<PointToPointChannel>(nd1->GetChannel());
+    if (ppChannel == nullptr)
+      continue;
+
+    Ptr<NetDevice> nd2 = ppChannel->GetDevice(0);
+    if (nd2->GetNode() == from)
+      nd2 = ppChannel->GetDevice(1);
+
+    if (nd2->GetNode() == to) {
+      return transport;
+    }
+  }
+  NS_FATAL_ERROR("There is no link between the requested nodes");
+  return nullptr;
+}
+
+void
+FluidTrafficHelper::changeRate(Ptr<Node> from, Ptr<Node> to, int64_t delta, uint32_t packetSize)
+{
+  NetDeviceTransport* transport = findTransport(from, to);
+
+  int64_t rate = static_cast<int64_t>(transport->GetBackgroundRate().GetBitRate()) + delta;
+  NS_ASSERT(rate >= 0);
+
+  NS_LOG_INFO("Background rate from node " << from->GetId() << " to node " << to->GetId()
+              << ": " << rate << "bps");
+  transport->SetBackgroundTraffic(DataRate(static_cast<uint64_t>(rate)), packetSize);
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,85 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_FLUID_TRAFFIC_HELPER_H
+#define NDN_FLUID_TRAFFIC_HELPER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/ptr.h"
+#include "ns3/node.h"
+#include "ns3/nstime.h"
+#include "ns3/data-rate.h"
+
+namespace ns3 {
+namespace ndn {
+
+class NetDeviceTransport;
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Helper to load point-to-point links with fluid (rate-based) background traffic
+ *
+ * Instead of simulating individual packets of background applications (e.g., many
+ * ConsumerCbr/Producer pairs), a background flow reserves its rate on the NDN link from one
+ * node to another for its lifetime.  Packets of the simulated (foreground) applications are
+ * sent at the residual rate of the link and are delayed by the analytic waiting time behind
+ * background packets (see NetDeviceTransport), so that background traffic does not generate
+ * any simulator events besides the start and the end of every flow.
+ *
+ * Note that only PointToPointChannels are supported by this helper
+ */
+class FluidTrafficHelper {
+public:
+  /**
+   * @brief Add background flow of rate @p rate on the link from @p from to @p to, active from
+   *        @p start until @p stop
+   *
+   * Rates of concurrent flows on the same link are summed up.  @p start and @p stop are
+   * absolute simulation times.
+   *
+   * @param packetSize mean size of background packets (bytes), determines the waiting time of
+   *                   foreground packets
+   */
+  static void
+  AddFlow(Ptr<Node> from, Ptr<Node> to, DataRate rate, Time start, Time stop,
+          uint32_t packetSize = 1100);
+
+  /**
+   * @brief Add background flow of rate @p rate on the link from @p from to @p to, active from
+   *        @p start until @p stop
+   *
+   * This variant uses node names registered by Names class
+   */
+  static void
+  AddFlowByName(const std::string& from, const std::string& to, DataRate rate, Time start,
+                Time stop, uint32_t packetSize = 1100);
+
+private:
+  static NetDeviceTransport*
+  findTransport(Ptr<Node> from, Ptr<Node> to);
+
+  static void
+  changeRate(Ptr<Node> from, Ptr<Node> to, int64_t delta, uint32_t packetSize);
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_FLUID_TRAFFIC_HELPER_H
@@ -70,6 +70,12 @@ ScenarioHelper::disableRibManager()
   ndnHelper.disableRibManager();
 }
 
+void
+ScenarioHelper::disableFibManager()
+{
+  ndnHelper.disableFibManager();
+}
+
 // void
 // ScenarioHelper::disableFaceManager()
 // {
@@ -171,6 +171,12 @@ public: // topology accessors
   void
   disableRibManager();
 
+  /**
+   * \brief Disable FIB Manager
+   */
+  void
+  disableFibManager();
+
   // Cannot be disabled for now
   // /**
   //  * \brief Disable Face Manager
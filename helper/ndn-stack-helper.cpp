@@ -46,11 +46,14 @@ namespace ndn {
 
 StackHelper::StackHelper()
   : m_isRibManagerDisabled(false)
+  , m_isFibManagerDisabled(false)
+  , m_isManagementDisabled(false)
   // , m_isFaceManagerDisabled(false)
   , m_isForwarderStatusManagerDisabled(false)
   , m_isStrategyChoiceManagerDisabled(false)
   , m_needSetDefaultRoutes(false)
   , m_maxCsSize(100)
+  , m_isCongestionMarkingEnabled(false)
 {
   setCustomNdnCxxClocks();
 
@@ -184,6 +187,14 @@ StackHelper::Install(Ptr<Node> node) const
     ndn->getConfig().put("ndnSIM.disable_rib_manager", true);
   }
 
+  if (m_isFibManagerDisabled) {
+    ndn->getConfig().put("ndnSIM.disable_fib_manager", true);
+  }
+
+  if (m_isManagementDisabled) {
+    ndn->getConfig().put("ndnSIM.disable_management", true);
+  }
+
   // if (m_isFaceManagerDisabled) {
   //   ndn->getConfig().put("ndnSIM.disable_face_manager", true);
   // }
@@ -324,6 +335,9 @@ StackHelper::PointToPointNetDeviceCallback(Ptr<Node> node, Ptr<L3Protocol> ndn,
   auto transport = make_unique<NetDeviceTransport>(node, netDevice,
                                                    constructFaceUri(netDevice),
                                                    constructFaceUri(remoteNetDevice));
+  if (m_isCongestionMarkingEnabled) {
+    transport->SetCongestionMarking(m_congestionMarkingTarget, m_congestionMarkingInterval);
+  }
 
   auto face = std::make_shared<Face>(std::move(linkService), std::move(transport));
   face->setMetric(1);
@@ -414,6 +428,18 @@ StackHelper::disableRibManager()
   m_isRibManagerDisabled = true;
 }
 
+void
+StackHelper::disableFibManager()
+{
+  m_isFibManagerDisabled = true;
+}
+
+void
+StackHelper::disableManagement()
+{
+  m_isManagementDisabled = true;
+}
+
 // void
 // StackHelper::disableFaceManager()
 // {
@@ -432,5 +458,13 @@ StackHelper::disableForwarderStatusManager()
   m_isForwarderStatusManagerDisabled = true;
 }
 
+void
+StackHelper::SetCongestionMarking(Time target, Time interval)
+{
+  m_isCongestionMarkingEnabled = true;
+  m_congestionMarkingTarget = target;
+  m_congestionMarkingInterval = interval;
+}
+
 } // namespace ndn
 } // namespace ns3
@@ -26,6 +26,7 @@
 #include "ns3/object-factory.h"
 #include "ns3/node.h"
 #include "ns3/node-container.h"
+#include "ns3/nstime.h"
 
 #include "ndn-face-container.hpp"
 #include "ndn-fib-helper.hpp"
@@ -229,6 +230,30 @@ public:
   void
   disableRibManager();
 
+  /**
+   * \brief Disable FIB Manager
+   *
+   * Intended for pure-forwarding routers that never receive FIB management commands.  Routes
+   * can still be installed using FibHelper, which then updates node's FIB directly.
+   *
+   * \note RIB manager relies on FIB manager and is not started if FIB manager is disabled
+   */
+  void
+  disableFibManager();
+
+  /**
+   * \brief Disable all NFD management components ("fast-path" forwarder)
+   *
+   * Installed stacks contain only the forwarder and its faces: no internal face, dispatcher,
+   * command authenticator, managers, or RIB.  FIB and strategy choice tables are populated
+   * directly by FibHelper, StrategyChoiceHelper, and GlobalRoutingHelper.
+   *
+   * Intended for large topologies where routers never receive management commands after
+   * routes have been installed.
+   */
+  void
+  disableManagement();
+
   // Cannot be disabled for now
   // /**
   //  * \brief Disable Face Manager
@@ -248,6 +273,18 @@ public:
   void
   disableForwarderStatusManager();
 
+  /**
+   * \brief Enable congestion marking of Data on point-to-point faces
+   *
+   * Outgoing Data get the NDNLP CongestionMark field when the queuing delay in the device
+   * queue exceeds @p target (see NetDeviceTransport).
+   *
+   * \param target queuing delay above which Data is marked
+   * \param interval base marking interval (CoDel-like); zero to mark every Data above target
+   */
+  void
+  SetCongestionMarking(Time target = MilliSeconds(5), Time interval = MilliSeconds(100));
+
 private:
   shared_ptr<Face>
   DefaultNetDeviceCallback(Ptr<Node> node, Ptr<L3Protocol> ndn, Ptr<NetDevice> netDevice) const;
@@ -259,6 +296,8 @@ private:
   createAndRegisterFace(Ptr<Node> node, Ptr<L3Protocol> ndn, Ptr<NetDevice> device) const;
 
   bool m_isRibManagerDisabled;
+  bool m_isFibManagerDisabled;
+  bool m_isManagementDisabled;
   // bool m_isFaceManagerDisabled;
   bool m_isForwarderStatusManagerDisabled;
   bool m_isStrategyChoiceManagerDisabled;
@@ -274,6 +313,10 @@ private:
   bool m_needSetDefaultRoutes;
   size_t m_maxCsSize;
 
+  bool m_isCongestionMarkingEnabled;
+  Time m_congestionMarkingTarget;
+  Time m_congestionMarkingInterval;
+
   typedef std::function<std::unique_ptr<nfd::cs::Policy>()> PolicyCreationCallback;
   PolicyCreationCallback m_csPolicyCreationFunc;
 
@@ -56,6 +56,14 @@ StrategyChoiceHelper::Install(const NodeContainer& c, const Name& namePrefix, co
 void
 StrategyChoiceHelper::Install(Ptr<Node> node, const Name& namePrefix, const Name& strategy)
 {
+  Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
+  if (l3protocol->getStrategyChoiceManager() == nullptr) {
+    // strategy choice manager is disabled, update StrategyChoice table directly
+    NS_LOG_DEBUG("Node ID: " << node->GetId() << " with forwarding strategy " << strategy);
+    l3protocol->getForwarder()->getStrategyChoice().insert(namePrefix, strategy);
+    return;
+  }
+
   ControlParameters parameters;
   parameters.setName(namePrefix);
   NS_LOG_DEBUG("Node ID: " << node->GetId() << " with forwarding strategy " << strategy);
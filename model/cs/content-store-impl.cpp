@@ -25,6 +25,7 @@
 #include "../../utils/trie/lfu-policy.hpp"
 #include "../../utils/trie/multi-policy.hpp"
 #include "../../utils/trie/aggregate-stats-policy.hpp"
+#include "custom-policies/rtc-policy.hpp"
 
 #define NS_OBJECT_ENSURE_REGISTERED_TEMPL(type, templ)                                             \
   static struct X##type##templ##RegistrationClass {                                                \
@@ -68,6 +69,12 @@ NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, random_policy_traits);
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, fifo_policy_traits);
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, lfu_policy_traits);
 
+/**
+ * @brief ContentStore with RTC-aware cache replacement policy
+ **/
+template class ContentStoreImpl<rtc_policy_traits>;
+NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, rtc_policy_traits);
+
 typedef multi_policy_traits<boost::mpl::vector2<lru_policy_traits, aggregate_stats_policy_traits>>
   LruWithCountsTraits;
 typedef multi_policy_traits<boost::mpl::vector2<random_policy_traits,
@@ -114,6 +121,13 @@ class Random : public ContentStoreImpl<random_policy_traits> {
  */
 class Lfu : public ContentStoreImpl<lfu_policy_traits> {
 };
+
+/**
+ * \brief Content Store that keeps the latest key frames and deltas of current GOPs of RTC
+ * streams, evicting frames of superseded GOPs first
+ */
+class Rtc : public ContentStoreImpl<rtc_policy_traits> {
+};
 #endif
 
 } // namespace cs
@@ -0,0 +1,324 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef RTC_POLICY_H_
+#define RTC_POLICY_H_
+
+/// @cond include_hidden
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/utils/ndn-rtc-name.hpp"
+
+#include <boost/intrusive/options.hpp>
+#include <boost/intrusive/list.hpp>
+
+#include <map>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+
+/**
+ * @brief Traits for RTC-aware replacement policy
+ *
+ * Data of RTC streams (see RtcNamespace) is grouped by stream and by GOP (key frame and the
+ * delta frames paired with it).  When the cache is full, items are evicted in the following
+ * order, least recently used first within each class:
+ *
+ * 1. delta frames of superseded GOPs (older than the latest key frame of their stream)
+ * 2. key frames of superseded GOPs
+ * 3. non-RTC Data
+ * 4. delta frames of the current GOPs
+ * 5. latest key frames
+ *
+ * so that a bootstrapping consumer finds the latest key frame and deltas of the current GOP
+ * in the cache.  In addition, deltas of GOPs that are older than the previous one are
+ * evicted as soon as Data of a newer GOP of the stream is cached, as no consumer can display
+ * them any longer.
+ *
+ * Iteration over the policy container (e.g., ContentStore::Print) visits only non-RTC Data.
+ */
+struct rtc_policy_traits {
+  /// @brief Name that can be used to identify the policy (for NS-3 object model and logging)
+  static std::string
+  GetName()
+  {
+    return "Rtc";
+  }
+
+  struct policy_hook_type : public boost::intrusive::list_member_hook<> {
+  };
+
+  template<class Container>
+  struct container_hook {
+    typedef boost::intrusive::member_hook<Container, policy_hook_type, &Container::policy_hook_>
+      type;
+  };
+
+  /**
+   * @brief Find RTC stream of @p name and parse the name
+   * @return false if @p name is not a name of a key or delta frame (segment)
+   */
+  static bool
+  parse(const Name& name, Name& streamPrefix, RtcName& parsed)
+  {
+    for (size_t i = 0; i < name.size(); i++) {
+      RtcFrameType type = RtcNamespace::getFrameType(name[i]);
+      if (type == RTC_FRAME_KEY || type == RTC_FRAME_DELTA) {
+        streamPrefix = name.getPrefix(i);
+        parsed = RtcNamespace(streamPrefix).parse(name);
+        return parsed.keyId != RtcName::NONE
+               && (parsed.type == RTC_FRAME_KEY || parsed.deltaId != RtcName::NONE);
+      }
+    }
+    return false;
+  }
+
+  template<class Base, class Container, class Hook>
+  struct policy {
+    typedef typename boost::intrusive::list<Container, Hook> policy_container;
+
+    class type : public policy_container {
+    public:
+      typedef Container parent_trie;
+
+      type(Base& base)
+        : base_(base)
+        , max_size_(100)
+        , size_(0)
+      {
+      }
+
+      inline void
+      update(typename parent_trie::iterator item)
+      {
+        touch(item);
+      }
+
+      inline bool
+      insert(typename parent_trie::iterator item)
+      {
+        if (max_size_ != 0 && size_ >= max_size_) {
+          evict();
+        }
+
+        Name streamPrefix;
+        RtcName parsed;
+        if (!parse(item->payload()->GetName(), streamPrefix, parsed)) {
+          policy_container::push_back(*item);
+          size_++;
+          return true;
+        }
+
+        stream& s = streams_[streamPrefix];
+        gop& g = s.gops[parsed.keyId];
+        (parsed.type == RTC_FRAME_KEY ? g.keys : g.deltas).push_back(*item);
+        size_++;
+
+        // a delta frame implies that its paired key frame has been generated
+        if (parsed.keyId > s.latestKey) {
+          s.latestKey = parsed.keyId;
+          evictStaleDeltas(s);
+        }
+        return true;
+      }
+
+      inline void
+      lookup(typename parent_trie::iterator item)
+      {
+        touch(item);
+      }
+
+      inline void
+      erase(typename parent_trie::iterator item)
+      {
+        Name streamPrefix;
+        RtcName parsed;
+        size_--;
+        if (!parse(item->payload()->GetName(), streamPrefix, parsed)) {
+          policy_container::erase(policy_container::s_iterator_to(*item));
+          return;
+        }
+
+        stream& s = streams_[streamPrefix];
+        auto g = s.gops.find(parsed.keyId);
+        policy_container& list = parsed.type == RTC_FRAME_KEY ? g->second.keys : g->second.deltas;
+        list.erase(policy_container::s_iterator_to(*item));
+        if (g->second.keys.empty() && g->second.deltas.empty()) {
+          s.gops.erase(g);
+        }
+      }
+
+      inline void
+      clear()
+      {
+        policy_container::clear();
+        for (auto& s : streams_) {
+          for (auto& g : s.second.gops) {
+            g.second.keys.clear();
+            g.second.deltas.clear();
+          }
+        }
+        streams_.clear();
+        size_ = 0;
+      }
+
+      inline size_t
+      size() const
+      {
+        return size_;
+      }
+
+      inline void
+      set_max_size(size_t max_size)
+      {
+        max_size_ = max_size;
+      }
+
+      inline size_t
+      get_max_size() const
+      {
+        return max_size_;
+      }
+
+    private:
+      type()
+        : base_(*((Base*)0)){};
+
+      /// @brief Cached Data of a single GOP
+      struct gop {
+        policy_container keys;
+        policy_container deltas;
+      };
+
+      struct stream {
+        stream()
+          : latestKey(0)
+        {
+        }
+
+        uint64_t latestKey;
+        std::map<uint64_t, gop> gops;
+      };
+
+      /**
+       * @brief Get the list that contains @p item
+       */
+      policy_container&
+      getList(typename parent_trie::iterator item)
+      {
+        Name streamPrefix;
+        RtcName parsed;
+        if (!parse(item->payload()->GetName(), streamPrefix, parsed)) {
+          return *this;
+        }
+        gop& g = streams_[streamPrefix].gops[parsed.keyId];
+        return parsed.type == RTC_FRAME_KEY ? g.keys : g.deltas;
+      }
+
+      void
+      touch(typename parent_trie::iterator item)
+      {
+        policy_container& list = getList(item);
+        list.splice(list.end(), list, policy_container::s_iterator_to(*item));
+      }
+
+      /**
+       * @brief Evict least recently used item of the least useful class
+       */
+      void
+      evict()
+      {
+        // superseded GOPs, deltas first
+        for (bool isKey : {false, true}) {
+          for (auto& s : streams_) {
+            for (auto& g : s.second.gops) {
+              if (g.first >= s.second.latestKey) {
+                break;
+              }
+              policy_container& list = isKey ? g.second.keys : g.second.deltas;
+              if (!list.empty()) {
+                base_.erase(&(*list.begin()));
+                return;
+              }
+            }
+          }
+        }
+
+        if (!policy_container::empty()) {
+          base_.erase(&(*policy_container::begin()));
+          return;
+        }
+
+        // current GOPs, deltas first
+        for (bool isKey : {false, true}) {
+          for (auto& s : streams_) {
+            auto g = s.second.gops.find(s.second.latestKey);
+            if (g == s.second.gops.end()) {
+              continue;
+            }
+            policy_container& list = isKey ? g->second.keys : g->second.deltas;
+            if (!list.empty()) {
+              base_.erase(&(*list.begin()));
+              return;
+            }
+          }
+        }
+      }
+
+      /**
+       * @brief Evict deltas of GOPs older than the previous GOP of stream @p s
+       */
+      void
+      evictStaleDeltas(stream& s)
+      {
+        std::vector<uint64_t> staleGops;
+        for (auto& g : s.gops) {
+          if (g.first + 1 >= s.latestKey) {
+            break;
+          }
+          staleGops.push_back(g.first);
+        }
+
+        // erasing the last item of a GOP removes the GOP
+        for (uint64_t keyId : staleGops) {
+          for (auto g = s.gops.find(keyId); g != s.gops.end() && !g->second.deltas.empty();
+               g = s.gops.find(keyId)) {
+            base_.erase(&(*g->second.deltas.begin()));
+          }
+        }
+      }
+
+    private:
+      Base& base_;
+      size_t max_size_;
+      size_t size_;
+      std::map<Name, stream> streams_;
+    };
+  };
+};
+
+} // ndnSIM
+} // ndn
+} // ns3
+
+/// @endcond
+
+#endif // RTC_POLICY_H_
@@ -44,6 +44,8 @@ AppLinkService::AppLinkService(Ptr<App> app)
 AppLinkService::~AppLinkService()
 {
   NS_LOG_FUNCTION_NOARGS();
+
+  m_deliveryEvent.Cancel();
 }
 
 void
@@ -51,8 +53,8 @@ AppLinkService::doSendInterest(const Interest& interest)
 {
   NS_LOG_FUNCTION(this << &interest);
 
-  // to decouple callbacks
-  Simulator::ScheduleNow(&App::OnInterest, m_app, interest.shared_from_this());
+  m_pending.push_back({interest.shared_from_this(), nullptr, nullptr});
+  scheduleDelivery();
 }
 
 void
@@ -60,8 +62,8 @@ AppLinkService::doSendData(const Data& data)
 {
   NS_LOG_FUNCTION(this << &data);
 
-  // to decouple callbacks
-  Simulator::ScheduleNow(&App::OnData, m_app, data.shared_from_this());
+  m_pending.push_back({nullptr, data.shared_from_this(), nullptr});
+  scheduleDelivery();
 }
 
 void
@@ -69,8 +71,40 @@ AppLinkService::doSendNack(const lp::Nack& nack)
 {
   NS_LOG_FUNCTION(this << &nack);
 
-  // to decouple callbacks
-  Simulator::ScheduleNow(&App::OnNack, m_app, make_shared<lp::Nack>(nack));
+  m_pending.push_back({nullptr, nullptr, make_shared<lp::Nack>(nack)});
+  scheduleDelivery();
+}
+
+void
+AppLinkService::scheduleDelivery()
+{
+  // to decouple callbacks; one event delivers everything sent at the current time
+  if (!m_deliveryEvent.IsRunning()) {
+    m_deliveryEvent = Simulator::ScheduleNow(&AppLinkService::deliverPending, this);
+  }
+}
+
+void
+AppLinkService::deliverPending()
+{
+  NS_LOG_FUNCTION(this << m_pending.size());
+
+  // packets sent by the forwarder while the app processes this batch (e.g., Data satisfied
+  // from the local cache) go to a new batch, delivered by a new event
+  m_delivering.swap(m_pending);
+
+  for (const Delivery& delivery : m_delivering) {
+    if (delivery.interest != nullptr) {
+      m_app->OnInterest(delivery.interest);
+    }
+    else if (delivery.data != nullptr) {
+      m_app->OnData(delivery.data);
+    }
+    else {
+      m_app->OnNack(delivery.nack);
+    }
+  }
+  m_delivering.clear();
 }
 
 //
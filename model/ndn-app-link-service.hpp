@@ -23,6 +23,10 @@
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 #include "ns3/ndnSIM/NFD/daemon/face/link-service.hpp"
 
+#include "ns3/event-id.h"
+
+#include <vector>
+
 namespace ns3 {
 
 class Packet;
@@ -36,6 +40,10 @@ class App;
  * \ingroup ndn-face
  * \brief Implementation of LinkService for ndnSIM application
  *
+ * Packets from the forwarder are not delivered to the application synchronously (to decouple
+ * callbacks), but are queued and delivered in the original order by a single event scheduled
+ * for the current simulation time, regardless of how many packets are sent at this time.
+ *
  * \see NetDeviceLinkService
  */
 class AppLinkService : public nfd::face::LinkService
@@ -75,9 +83,28 @@ private:
     BOOST_ASSERT(false);
   }
 
+  void
+  scheduleDelivery();
+
+  void
+  deliverPending();
+
 private:
   Ptr<Node> m_node;
   Ptr<App> m_app;
+
+  /// @cond include_hidden
+  struct Delivery
+  {
+    shared_ptr<const Interest> interest;
+    shared_ptr<const Data> data;
+    shared_ptr<const lp::Nack> nack;
+  };
+  /// @endcond
+
+  std::vector<Delivery> m_pending;    ///< @brief packets waiting for delivery to the app
+  std::vector<Delivery> m_delivering; ///< @brief packets being delivered (reused buffer)
+  EventId m_deliveryEvent;
 };
 
 } // namespace ndn
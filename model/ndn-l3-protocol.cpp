@@ -108,10 +108,16 @@ L3Protocol::GetTypeId(void)
   return tid;
 }
 
-class L3Protocol::Impl {
-private:
-  Impl()
-  {
+/**
+ * \brief Parsed default NFD configuration
+ *
+ * The default configuration is the same for every node, so it is parsed only once per process
+ * and then copied into each L3Protocol instance (helpers adjust the per-node copy)
+ */
+static const nfd::ConfigSection&
+getDefaultConfig()
+{
+  static nfd::ConfigSection defaultConfig = [] {
     // Do not modify initial config file. Use helpers to set specific NFD parameters
     std::string initialConfig =
       "general\n"
@@ -161,8 +167,20 @@ private:
       "}\n"
       "\n";
 
+    nfd::ConfigSection config;
     std::istringstream input(initialConfig);
-    boost::property_tree::read_info(input, m_config);
+    boost::property_tree::read_info(input, config);
+    return config;
+  }();
+
+  return defaultConfig;
+}
+
+class L3Protocol::Impl {
+private:
+  Impl()
+    : m_config(getDefaultConfig())
+  {
   }
 
   friend class L3Protocol;
@@ -208,12 +226,21 @@ L3Protocol::initialize()
 {
   m_impl->m_forwarder = make_shared<nfd::Forwarder>();
 
-  initializeManagement();
+  bool isManagementDisabled = this->getConfig().get<bool>("ndnSIM.disable_management", false);
+  if (!isManagementDisabled) {
+    initializeManagement();
+  }
+  else {
+    initializeTables();
+  }
 
   nfd::FaceTable& faceTable = m_impl->m_forwarder->getFaceTable();
   faceTable.addReserved(nfd::face::makeNullFace(), nfd::face::FACEID_NULL);
 
-  if (!this->getConfig().get<bool>("ndnSIM.disable_rib_manager", false)) {
+  // RIB manager installs its routes through FIB manager, so it cannot work without it
+  if (!isManagementDisabled &&
+      !this->getConfig().get<bool>("ndnSIM.disable_rib_manager", false) &&
+      !this->getConfig().get<bool>("ndnSIM.disable_fib_manager", false)) {
     Simulator::ScheduleWithContext(m_node->GetId(), Seconds(0), &L3Protocol::initializeRibManager, this);
   }
 
@@ -245,6 +272,8 @@ private:
 void
 L3Protocol::injectInterest(const Interest& interest)
 {
+  NS_ASSERT_MSG(m_impl->m_internalFace != nullptr,
+                "Management is disabled on this node, commands cannot be injected");
   m_impl->m_internalFace->sendInterest(interest);
 }
 
@@ -268,10 +297,16 @@ L3Protocol::initializeManagement()
 
   m_impl->m_authenticator = CommandAuthenticator::create();
 
-  m_impl->m_fibManager.reset(new FibManager(forwarder->getFib(),
-                                            forwarder->getFaceTable(),
-                                            *m_impl->m_dispatcher,
-                                            *m_impl->m_authenticator));
+  if (!this->getConfig().get<bool>("ndnSIM.disable_fib_manager", false)) {
+    m_impl->m_fibManager.reset(new FibManager(forwarder->getFib(),
+                                              forwarder->getFaceTable(),
+                                              *m_impl->m_dispatcher,
+                                              *m_impl->m_authenticator));
+  }
+  else {
+    // FIB is populated directly by FibHelper
+    this->getConfig().get_child("authorizations").get_child("authorize").get_child("privileges").erase("fib");
+  }
 
   // Cannot be disabled for now
   // if (!this->getConfig().get<bool>("ndnSIM.disable_face_manager", false))
@@ -326,6 +361,29 @@ L3Protocol::initializeManagement()
   m_impl->m_dispatcher->addTopPrefix(topPrefix, false);
 }
 
+void
+L3Protocol::initializeTables()
+{
+  auto& forwarder = m_impl->m_forwarder;
+  using namespace nfd;
+
+  // if we use NFD's CS, we have to specify a replacement policy
+  m_impl->m_csFromNdnSim = GetObject<ContentStore>();
+  if (m_impl->m_csFromNdnSim == nullptr) {
+    forwarder->getCs().setPolicy(m_impl->m_policy());
+  }
+
+  ConfigFile config(&ConfigFile::ignoreUnknownSection);
+
+  TablesConfigSection tablesConfig(*forwarder);
+  tablesConfig.setConfigFile(config);
+
+  // apply config
+  config.parse(m_impl->m_config, false, "ndnSIM.conf");
+
+  tablesConfig.ensureConfigured();
+}
+
 void
 L3Protocol::initializeRibManager()
 {
@@ -103,12 +103,16 @@ public:
 
   /**
    * \brief Get smart pointer to nfd::FibManager, used by node's NFD
+   *
+   * \return nullptr if FIB manager has been disabled
    */
   shared_ptr<nfd::FibManager>
   getFibManager();
 
   /**
    * \brief Get smart pointer to nfd::StrategyChoiceManager, used by node's NFD
+   *
+   * \return nullptr if strategy choice manager has been disabled
    */
   shared_ptr<nfd::StrategyChoiceManager>
   getStrategyChoiceManager();
@@ -152,6 +156,8 @@ public:
 
   /**
    * \brief Inject interest through internal Face
+   *
+   * Must not be used when management has been disabled on the node
    */
   void
   injectInterest(const Interest& interest);
@@ -195,6 +201,14 @@ private:
   void
   initializeManagement();
 
+  /**
+   * \brief Configure forwarder tables without creating any management components
+   *
+   * Used for fast-path nodes (see StackHelper::disableManagement)
+   */
+  void
+  initializeTables();
+
   void
   initializeRibManager();
 
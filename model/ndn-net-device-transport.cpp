@@ -23,9 +23,16 @@
 #include "ndn-block-header.hpp"
 #include "../utils/ndn-ns3-packet-tag.hpp"
 
+#include "ns3/simulator.h"
+
 #include <ndn-cxx/encoding/block.hpp>
+#include <ndn-cxx/encoding/tlv.hpp>
 #include <ndn-cxx/interest.hpp>
 #include <ndn-cxx/data.hpp>
+#include <ndn-cxx/lp/packet.hpp>
+
+#include <algorithm>
+#include <cmath>
 
 NS_LOG_COMPONENT_DEFINE("ndn.NetDeviceTransport");
 
@@ -41,6 +48,11 @@ NetDeviceTransport::NetDeviceTransport(Ptr<Node> node,
                                        ::ndn::nfd::LinkType linkType)
   : m_netDevice(netDevice)
   , m_node(node)
+  , m_isMarkingEnabled(false)
+  , m_nextMarkTime(Time::Max())
+  , m_nMarkedSinceInMarkingState(0)
+  , m_backgroundDelay(0)
+  , m_lastDeferredSend(0)
 {
   this->setLocalUri(FaceUri(localUri));
   this->setRemoteUri(FaceUri(remoteUri));
@@ -74,18 +86,151 @@ NetDeviceTransport::doClose()
   this->setState(nfd::face::TransportState::CLOSED);
 }
 
+void
+NetDeviceTransport::SetCongestionMarking(Time target, Time interval)
+{
+  Ptr<PointToPointNetDevice> device = DynamicCast<PointToPointNetDevice>(m_netDevice);
+  if (device == nullptr) {
+    NS_LOG_WARN("Congestion marking is supported only on point-to-point devices");
+    return;
+  }
+
+  DataRateValue rate;
+  device->GetAttribute("DataRate", rate);
+
+  m_queue = device->GetQueue();
+  m_dataRate = rate.Get();
+  m_isMarkingEnabled = true;
+  m_markingTarget = target;
+  m_markingInterval = interval;
+  m_nextMarkTime = Time::Max();
+  m_nMarkedSinceInMarkingState = 0;
+}
+
+void
+NetDeviceTransport::SetBackgroundTraffic(DataRate rate, uint32_t packetSize)
+{
+  static const double MAX_UTILIZATION = 0.99;
+
+  Ptr<PointToPointNetDevice> device = DynamicCast<PointToPointNetDevice>(m_netDevice);
+  if (device == nullptr) {
+    NS_LOG_WARN("Background traffic is supported only on point-to-point devices");
+    return;
+  }
+
+  if (m_linkRate.GetBitRate() == 0) {
+    DataRateValue linkRate;
+    device->GetAttribute("DataRate", linkRate);
+    m_linkRate = linkRate.Get();
+  }
+
+  double utilization = static_cast<double>(rate.GetBitRate()) / m_linkRate.GetBitRate();
+  if (utilization > MAX_UTILIZATION) {
+    NS_LOG_WARN("Background traffic of " << rate << " overloads link of " << m_linkRate);
+    utilization = MAX_UTILIZATION;
+  }
+
+  m_backgroundRate = rate;
+  m_backgroundDelay = Seconds(utilization / (1 - utilization)
+                              * m_linkRate.CalculateBytesTxTime(packetSize).GetSeconds());
+
+  DataRate residualRate(static_cast<uint64_t>(m_linkRate.GetBitRate() * (1 - utilization)));
+  device->SetDataRate(residualRate);
+  if (m_isMarkingEnabled) {
+    m_dataRate = residualRate;
+  }
+
+  NS_LOG_DEBUG("Background rate " << rate << ", residual rate " << residualRate
+               << ", waiting time " << m_backgroundDelay.As(Time::MS));
+}
+
+Time
+NetDeviceTransport::GetQueueDelay() const
+{
+  if (m_queue == nullptr || m_dataRate.GetBitRate() == 0) {
+    return m_backgroundDelay;
+  }
+
+  return m_dataRate.CalculateBytesTxTime(m_queue->GetNBytes()) + m_backgroundDelay;
+}
+
+bool
+NetDeviceTransport::isMarkDue()
+{
+  if (GetQueueDelay() <= m_markingTarget) {
+    // congestion incident has ended (or has not started)
+    m_nextMarkTime = Time::Max();
+    m_nMarkedSinceInMarkingState = 0;
+    return false;
+  }
+
+  if (m_markingInterval.IsZero()) {
+    return true;
+  }
+
+  Time now = Simulator::Now();
+  if (m_nextMarkTime == Time::Max()) {
+    m_nextMarkTime = now + m_markingInterval;
+    return false;
+  }
+  return now >= m_nextMarkTime;
+}
+
+bool
+NetDeviceTransport::markData(Packet& packet)
+{
+  // bare network packets are wrapped into LpPacket
+  lp::Packet lpPacket(packet.packet);
+  if (!lpPacket.has<lp::FragmentField>()
+      || (lpPacket.has<lp::FragIndexField>() && lpPacket.get<lp::FragIndexField>() != 0)) {
+    return false;
+  }
+
+  ::ndn::Buffer::const_iterator begin, end;
+  std::tie(begin, end) = lpPacket.get<lp::FragmentField>();
+  uint32_t type = 0;
+  if (!::ndn::tlv::readType(begin, end, type) || type != ::ndn::tlv::Data) {
+    return false;
+  }
+
+  if (!lpPacket.has<lp::CongestionMarkField>()) {
+    lpPacket.add<lp::CongestionMarkField>(1);
+    packet.packet = lpPacket.wireEncode();
+  }
+  return true;
+}
+
 void
 NetDeviceTransport::doSend(Packet&& packet)
 {
   NS_LOG_FUNCTION(this << "Sending packet from netDevice with URI"
                   << this->getLocalUri());
 
+  if (m_isMarkingEnabled && isMarkDue() && markData(packet)) {
+    NS_LOG_DEBUG("Queuing delay " << GetQueueDelay().As(Time::MS) << ", Data marked");
+    if (!m_markingInterval.IsZero()) {
+      ++m_nMarkedSinceInMarkingState;
+      // decrease the marking interval by the inverse of the square root of the number of
+      // packets marked in this incident of congestion
+      m_nextMarkTime += Seconds(m_markingInterval.ToDouble(Time::S)
+                                / std::sqrt(m_nMarkedSinceInMarkingState + 1));
+    }
+  }
+
   // convert NFD packet to NS3 packet
   BlockHeader header(packet);
 
   Ptr<ns3::Packet> ns3Packet = Create<ns3::Packet>();
   ns3Packet->AddHeader(header);
 
+  if (!m_backgroundDelay.IsZero() || m_lastDeferredSend > Simulator::Now()) {
+    // wait behind background packets, without overtaking packets that waited longer
+    m_lastDeferredSend = std::max(Simulator::Now() + m_backgroundDelay, m_lastDeferredSend);
+    Simulator::Schedule(m_lastDeferredSend - Simulator::Now(), &NetDevice::Send, m_netDevice,
+                        ns3Packet, m_netDevice->GetBroadcast(), L3Protocol::ETHERNET_FRAME_TYPE);
+    return;
+  }
+
   // send the NS3 packet
   m_netDevice->Send(ns3Packet, m_netDevice->GetBroadcast(),
                     L3Protocol::ETHERNET_FRAME_TYPE);
@@ -31,6 +31,9 @@
 
 #include "ns3/point-to-point-net-device.h"
 #include "ns3/channel.h"
+#include "ns3/queue.h"
+#include "ns3/data-rate.h"
+#include "ns3/nstime.h"
 
 namespace ns3 {
 namespace ndn {
@@ -38,6 +41,23 @@ namespace ndn {
 /**
  * \ingroup ndn-face
  * \brief ndnSIM-specific transport
+ *
+ * If congestion marking is enabled (point-to-point devices only), the transport estimates the
+ * queuing delay of each sent packet from the backlog of the device queue and the link data rate,
+ * and sets the NDNLP CongestionMark field of outgoing Data when the delay exceeds the target:
+ *
+ * - with zero interval, every Data sent while the delay is above the target is marked;
+ * - otherwise (CoDel-like, as in NFD's GenericLinkService), the first Data is marked after the
+ *   delay has stayed above the target for one interval, and subsequent Data at intervals
+ *   decreasing with the inverse square root of the number of marks, until the delay drops
+ *   below the target.
+ *
+ * Fluid background traffic (see FluidTrafficHelper) is modeled analytically on point-to-point
+ * devices: the data rate of the device is reduced by the background rate, and every packet is
+ * handed to the device after the mean waiting time behind background packets in an M/M/1
+ * queue, \f$\rho / (1 - \rho)\f$ background packet transmission times for background
+ * utilization \f$\rho\f$ (capped at 0.99).  The waiting time is also included in the
+ * queuing delay estimate used for congestion marking.
  */
 class NetDeviceTransport : public nfd::face::Transport
 {
@@ -54,6 +74,34 @@ public:
   Ptr<NetDevice>
   GetNetDevice() const;
 
+  /**
+   * \brief Enable congestion marking of Data
+   * \param target queuing delay above which Data is marked
+   * \param interval base marking interval, zero to mark every Data above the target
+   */
+  void
+  SetCongestionMarking(Time target, Time interval);
+
+  /**
+   * \brief Set rate of fluid background traffic sent through the device
+   * \param rate total background rate, zero to disable background traffic
+   * \param packetSize mean size of background packets (bytes)
+   */
+  void
+  SetBackgroundTraffic(DataRate rate, uint32_t packetSize);
+
+  DataRate
+  GetBackgroundRate() const
+  {
+    return m_backgroundRate;
+  }
+
+  /**
+   * \brief Estimated queuing delay of a packet sent now
+   */
+  Time
+  GetQueueDelay() const;
+
 private:
   virtual void
   doClose() override;
@@ -68,8 +116,35 @@ private:
                        const Address& from, const Address& to,
                        NetDevice::PacketType packetType);
 
+  /**
+   * \brief Update marking state and check whether the next Data is to be marked
+   */
+  bool
+  isMarkDue();
+
+  /**
+   * \brief Set CongestionMark field, if @p packet is a Data or the first fragment of a Data
+   * \return whether the packet has been marked
+   */
+  static bool
+  markData(Packet& packet);
+
   Ptr<NetDevice> m_netDevice; ///< \brief Smart pointer to NetDevice
   Ptr<Node> m_node;
+
+  Ptr<QueueBase> m_queue; ///< \brief queue of the device, if it can be inspected
+  DataRate m_dataRate;
+
+  bool m_isMarkingEnabled;
+  Time m_markingTarget;
+  Time m_markingInterval;
+  Time m_nextMarkTime;   ///< \brief Time::Max() when not in marking state
+  size_t m_nMarkedSinceInMarkingState;
+
+  DataRate m_linkRate;       ///< \brief data rate of the device without background traffic
+  DataRate m_backgroundRate;
+  Time m_backgroundDelay;    ///< \brief waiting time behind background packets
+  Time m_lastDeferredSend;   ///< \brief keeps packets delayed by m_backgroundDelay in order
 };
 
 } // namespace ndn
@@ -49,6 +49,8 @@ public:
     : m_csSize(100)
     , m_interestRate(1000)
     , m_shouldEvaluatePit(false)
+    , m_isFastPath(false)
+    , m_nStackNodes(0)
     , m_simulationTime(Seconds(2000) / m_interestRate)
   {
   }
@@ -62,11 +64,20 @@ public:
   void
   printStats(std::ostream& os, Time nextPrintTime, double beginRealTime);
 
+  void
+  printStackOverhead(std::ostream& os);
+
+private:
+  double
+  measureStackOverhead(bool isFastPath);
+
 private:
   std::string m_oldContentStore;
   size_t m_csSize;
   double m_interestRate;
   bool m_shouldEvaluatePit;
+  bool m_isFastPath;
+  uint32_t m_nStackNodes;
   std::string m_strategy;
   double m_initialOverhead;
   Time m_simulationTime;
@@ -153,6 +164,42 @@ Tester::printStats(std::ostream& os, Time nextPrintTime, double beginRealTime)
                       beginRealTime);
 }
 
+double
+Tester::measureStackOverhead(bool isFastPath)
+{
+  NodeContainer nodes;
+  nodes.Create(m_nStackNodes);
+
+  PointToPointHelper p2p;
+  for (uint32_t i = 1; i < nodes.GetN(); i++) {
+    p2p.Install(nodes.Get(i - 1), nodes.Get(i));
+  }
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.setCsSize(m_csSize);
+  if (isFastPath) {
+    ndnHelper.disableManagement();
+  }
+
+  // RIB manager is started at time 0 and is not accounted for
+  double before = MemUsage::Get() / 1024.0;
+  ndnHelper.Install(nodes);
+  double after = MemUsage::Get() / 1024.0;
+
+  return (after - before) / nodes.GetN();
+}
+
+void
+Tester::printStackOverhead(std::ostream& os)
+{
+  double fullOverhead = measureStackOverhead(false);
+  double fastPathOverhead = measureStackOverhead(true);
+
+  os << "Approximate memory overhead per node (full NFD stack):" << fullOverhead << "KiB\n";
+  os << "Approximate memory overhead per node (fast-path stack):" << fastPathOverhead << "KiB\n";
+  os << "Approximate memory saving per node:" << fullOverhead - fastPathOverhead << "KiB\n";
+}
+
 int
 Tester::run(int argc, char* argv[])
 {
@@ -175,8 +222,17 @@ Tester::run(int argc, char* argv[])
                            "/localhost/nfd/strategy/best-route, ...) ",
                m_strategy);
   cmd.AddValue("sim-time", "Simulation time", m_simulationTime);
+  cmd.AddValue("fast-path", "Install NDN stack without NFD management components",
+               m_isFastPath);
+  cmd.AddValue("stack-nodes", "Number of extra routers used to evaluate per-node memory "
+                              "overhead of full and fast-path stacks (0 to skip)",
+               m_nStackNodes);
   cmd.Parse(argc, argv);
 
+  if (m_nStackNodes != 0) {
+    printStackOverhead(std::cout);
+  }
+
   // Creating nodes
   NodeContainer nodes;
   nodes.Create(2);
@@ -189,11 +245,15 @@ Tester::run(int argc, char* argv[])
   ndn::StackHelper ndnHelper;
   ndnHelper.setCsSize(m_csSize);
 
+  if (m_isFastPath) {
+    ndnHelper.disableManagement();
+  }
+
   if (!m_oldContentStore.empty()) {
     ndnHelper.SetOldContentStore(m_oldContentStore, "MaxSize", std::to_string(m_csSize));
   }
 
-  ndnHelper.InstallAll();
+  ndnHelper.Install(nodes);
 
   ndn::FibHelper::AddRoute(nodes.Get(0), "/", nodes.Get(1), 10);
   if (!m_strategy.empty()) {
@@ -229,6 +289,13 @@ Tester::run(int argc, char* argv[])
 
   L2RateTracer::InstallAll("drop-trace2.txt", Seconds(0.5));
   Simulator::Run();
+
+  // consumer retransmission timer, tracers, and packet processing all add to this number
+  uint64_t nEvents = Simulator::GetEventCount();
+  std::cout << "Number of executed events:" << nEvents << "\t"
+            << "per Interest:" << nEvents / (m_interestRate * m_simulationTime.ToDouble(Time::S))
+            << "\n";
+
   Simulator::Destroy();
 
   return 0;
@@ -18,8 +18,11 @@
  **/
 
 #include "helper/ndn-stack-helper.hpp"
+#include "helper/ndn-app-helper.hpp"
 #include "../tests-common.hpp"
 
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
 #include "ns3/point-to-point-module.h"
 
 namespace ns3 {
@@ -62,6 +65,84 @@ BOOST_AUTO_TEST_CASE(TestNfdContentStorePolicy)
   BOOST_CHECK_EQUAL(protoNode1->getForwarder()->getCs().getPolicy()->getName(), "priority_fifo");
 }
 
+BOOST_AUTO_TEST_CASE(DisabledFibManager)
+{
+  NodeContainer nodes;
+  nodes.Create(2);
+
+  PointToPointHelper p2p;
+  p2p.Install(nodes.Get(0), nodes.Get(1));
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.disableFibManager();
+  ndnHelper.disableStrategyChoiceManager();
+  ndnHelper.Install(nodes.Get(0));
+
+  ndn::StackHelper fullHelper;
+  fullHelper.Install(nodes.Get(1));
+
+  Ptr<L3Protocol> protoNode0 = L3Protocol::getL3Protocol(nodes.Get(0));
+  Ptr<L3Protocol> protoNode1 = L3Protocol::getL3Protocol(nodes.Get(1));
+  BOOST_CHECK(protoNode0->getFibManager() == nullptr);
+  BOOST_CHECK(protoNode0->getStrategyChoiceManager() == nullptr);
+
+  // per-node config is a copy of the shared default config
+  BOOST_CHECK(protoNode1->getFibManager() != nullptr);
+  BOOST_CHECK_EQUAL(protoNode1->getConfig().get<bool>("ndnSIM.disable_fib_manager", false), false);
+
+  // helpers update tables directly when managers are disabled
+  FibHelper::AddRoute(nodes.Get(0), "/prefix", nodes.Get(1), 1);
+  BOOST_CHECK(protoNode0->getForwarder()->getFib().findExactMatch("/prefix") != nullptr);
+
+  StrategyChoiceHelper::Install(nodes.Get(0), "/prefix", "/localhost/nfd/strategy/multicast");
+  BOOST_CHECK_EQUAL(protoNode0->getForwarder()->getStrategyChoice().findEffectiveStrategy("/prefix")
+                      .getInstanceName().getPrefix(4),
+                    "/localhost/nfd/strategy/multicast");
+
+  FibHelper::RemoveRoute(nodes.Get(0), "/prefix", nodes.Get(1));
+  BOOST_CHECK(protoNode0->getForwarder()->getFib().findExactMatch("/prefix") == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(DisabledManagement)
+{
+  NodeContainer nodes;
+  nodes.Create(2);
+
+  PointToPointHelper p2p;
+  p2p.Install(nodes.Get(0), nodes.Get(1));
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.disableManagement();
+  ndnHelper.setCsSize(10);
+  ndnHelper.Install(nodes);
+
+  Ptr<L3Protocol> protoNode0 = L3Protocol::getL3Protocol(nodes.Get(0));
+  BOOST_CHECK(protoNode0->getFibManager() == nullptr);
+  BOOST_CHECK(protoNode0->getStrategyChoiceManager() == nullptr);
+  // null face and one NetDevice face, no internal faces
+  BOOST_CHECK_EQUAL(protoNode0->getForwarder()->getFaceTable().size(), 2);
+  // tables section of the config is still applied
+  BOOST_CHECK_EQUAL(protoNode0->getForwarder()->getCs().getLimit(), 10);
+
+  FibHelper::AddRoute(nodes.Get(0), "/prefix", nodes.Get(1), 1);
+
+  AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+  consumerHelper.SetPrefix("/prefix");
+  consumerHelper.SetAttribute("Frequency", StringValue("10"));
+  consumerHelper.Install(nodes.Get(0)).Stop(Seconds(0.95));
+
+  AppHelper producerHelper("ns3::ndn::Producer");
+  producerHelper.SetPrefix("/prefix");
+  producerHelper.Install(nodes.Get(1));
+
+  Simulator::Stop(Seconds(2.0));
+  Simulator::Run();
+
+  auto face = protoNode0->getFaceByNetDevice(nodes.Get(0)->GetDevice(0));
+  BOOST_CHECK_EQUAL(face->getCounters().nOutInterests, 10);
+  BOOST_CHECK_EQUAL(face->getCounters().nInData, 10);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
@@ -107,6 +107,20 @@ BOOST_AUTO_TEST_CASE(DisabledRibManager)
                                 receivedDatasets.begin(), receivedDatasets.end());
 }
 
+BOOST_AUTO_TEST_CASE(DisabledFibManager)
+{
+  // Disable FIB manager (RIB manager depends on it and is disabled as well)
+  disableFibManager();
+
+  setupAndRun();
+
+  BOOST_CHECK_EQUAL(requestedDatasets.size(), receivedDatasets.size() + 1);
+
+  requestedDatasets.erase("/localhost/nfd/rib/list");
+  BOOST_CHECK_EQUAL_COLLECTIONS(requestedDatasets.begin(), requestedDatasets.end(),
+                                receivedDatasets.begin(), receivedDatasets.end());
+}
+
 // BOOST_AUTO_TEST_CASE(DisabledFaceManager)
 // {
 //   // Disable Face manager
@@ -0,0 +1,127 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "model/ndn-net-device-transport.hpp"
+#include "helper/ndn-fluid-traffic-helper.hpp"
+
+#include <ndn-cxx/lp/tags.hpp>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class CongestionMarkingFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  CongestionMarkingFixture()
+    : nData(0)
+    , nMarkedData(0)
+  {
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("1Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+    Config::SetDefault("ns3::QueueBase::MaxPackets", UintegerValue(100));
+  }
+
+  void
+  run(const std::function<void()>& beforeRun = nullptr)
+  {
+    createTopology({
+        {"1", "2"},
+      });
+
+    addRoutes({
+        {"1", "2", "/prefix", 1},
+      });
+
+    addApps({
+        {"1", "ns3::ndn::ConsumerWindow",
+            {{"Prefix", "/prefix"}, {"Window", "50"}},
+            "0s", "1.9s"},
+        {"2", "ns3::ndn::Producer",
+            {{"Prefix", "/prefix"}, {"PayloadSize", "1024"}},
+            "0s", "100s"}
+      });
+
+    getNode("1")->GetApplication(0)->TraceConnectWithoutContext("ReceivedDatas",
+      MakeCallback(&CongestionMarkingFixture::onData, this));
+
+    if (beforeRun) {
+      beforeRun();
+    }
+
+    Simulator::Stop(Seconds(2.0));
+    Simulator::Run();
+  }
+
+private:
+  void
+  onData(shared_ptr<const Data> data, Ptr<App> app, shared_ptr<Face> face)
+  {
+    ++nData;
+    if (data->getTag<lp::CongestionMarkTag>() != nullptr) {
+      ++nMarkedData;
+    }
+  }
+
+public:
+  size_t nData;
+  size_t nMarkedData;
+};
+
+BOOST_FIXTURE_TEST_SUITE(ModelNdnNetDeviceTransport, CongestionMarkingFixture)
+
+BOOST_AUTO_TEST_CASE(MarkingDisabled)
+{
+  run();
+
+  BOOST_CHECK_GT(nData, 0);
+  BOOST_CHECK_EQUAL(nMarkedData, 0);
+}
+
+BOOST_AUTO_TEST_CASE(MarkingEnabled)
+{
+  // threshold mode: mark every Data while the queue holds more than 5ms worth of bytes
+  getStackHelper().SetCongestionMarking(MilliSeconds(5), Time(0));
+  run();
+
+  BOOST_CHECK_GT(nData, 0);
+  BOOST_CHECK_GT(nMarkedData, 0);
+  BOOST_CHECK_LT(nMarkedData, nData);
+}
+
+BOOST_AUTO_TEST_CASE(FluidBackgroundTraffic)
+{
+  // half of the 1Mbps link is taken by background traffic in the direction of Data
+  getStackHelper().SetCongestionMarking(MilliSeconds(5), Time(0));
+  run([this] {
+      FluidTrafficHelper::AddFlow(getNode("2"), getNode("1"), DataRate("500Kbps"), Seconds(0),
+                                  Seconds(100));
+    });
+
+  // ~215 Data fit into 1.9s on the unloaded link
+  BOOST_CHECK_GT(nData, 50);
+  BOOST_CHECK_LT(nData, 130);
+  BOOST_CHECK_GT(nMarkedData, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
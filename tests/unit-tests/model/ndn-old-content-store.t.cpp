@@ -18,6 +18,11 @@
  **/
 
 
+#include "model/cs/ndn-content-store.hpp"
+#include "utils/ndn-rtc-name.hpp"
+
+#include <set>
+
 #include "../tests-common.hpp"
 
 namespace ns3 {
@@ -67,6 +72,51 @@ BOOST_AUTO_TEST_CASE(RandomPolicy)
   BOOST_CHECK(entries["1"] != entries["2"]); // this test has a small chance of failing
 }
 
+BOOST_AUTO_TEST_CASE(RtcPolicy)
+{
+  ObjectFactory factory("ns3::ndn::cs::Rtc");
+  factory.Set("MaxSize", StringValue("5"));
+  Ptr<ContentStore> cs = factory.Create<ContentStore>();
+
+  RtcNamespace ns("/conference/producer");
+  auto key = [&] (uint64_t keyId) {
+    return Name(ns.getKeyFrameName(keyId)).appendSequenceNumber(0);
+  };
+  auto delta = [&] (uint64_t deltaId, uint64_t keyId) {
+    return Name(ns.getDeltaFrameName(deltaId, keyId)).appendSequenceNumber(0);
+  };
+  auto add = [&] (const Name& name) {
+    BOOST_CHECK(cs->Add(make_shared<Data>(name)));
+  };
+  auto getNames = [&] {
+    std::set<Name> names;
+    for (auto it = cs->Begin(); it != cs->End(); it = cs->Next(it)) {
+      names.insert(it->GetName());
+    }
+    return names;
+  };
+
+  add(key(0));
+  add(delta(0, 0));
+  add(delta(1, 0));
+  add("/other");
+  add(key(1));
+  BOOST_CHECK_EQUAL(cs->GetSize(), 5);
+
+  // deltas of the superseded GOP go first, then its key frame, then non-RTC Data
+  add(delta(0, 1));
+  add(delta(1, 1));
+  add(delta(2, 1));
+  add(delta(3, 1));
+  BOOST_CHECK((getNames() == std::set<Name>{key(1), delta(0, 1), delta(1, 1), delta(2, 1),
+                                            delta(3, 1)}));
+
+  // deltas of GOPs older than the previous one are dropped right away
+  add(key(3));
+  BOOST_CHECK((getNames() == std::set<Name>{key(1), key(3)}));
+  BOOST_CHECK_EQUAL(cs->GetSize(), 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
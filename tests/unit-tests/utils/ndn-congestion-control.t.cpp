@@ -0,0 +1,93 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-congestion-control.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsNdnCongestionControl, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(Aimd)
+{
+  Ptr<CongestionControl> cc = CreateObject<CongestionControlAimd>();
+  cc->Reset(1);
+
+  // slow start
+  for (int i = 0; i < 9; ++i) {
+    cc->OnData(MilliSeconds(100));
+  }
+  BOOST_CHECK_EQUAL(cc->GetWindow(), 10);
+
+  cc->OnTimeout();
+  BOOST_CHECK_EQUAL(cc->GetWindow(), 5);
+
+  // same congestion event
+  cc->OnNack();
+  cc->OnTimeout();
+  BOOST_CHECK_EQUAL(cc->GetWindow(), 5);
+
+  // congestion avoidance, about one per window of Data
+  for (int i = 0; i < 5; ++i) {
+    cc->OnData(Time(0));
+  }
+  BOOST_CHECK_CLOSE(cc->GetWindow(), 5.93, 0.1);
+
+  // one RTT later, a new congestion event
+  Simulator::Stop(MilliSeconds(200));
+  Simulator::Run();
+  cc->OnNack();
+  BOOST_CHECK_CLOSE(cc->GetWindow(), 5.93 / 2, 0.1);
+}
+
+BOOST_AUTO_TEST_CASE(Cubic)
+{
+  Ptr<CongestionControl> cc = CreateObject<CongestionControlCubic>();
+  cc->Reset(100);
+  cc->OnTimeout();
+  BOOST_CHECK_EQUAL(cc->GetWindow(), 70);
+
+  for (int i = 1; i <= 800; ++i) {
+    Simulator::Schedule(MilliSeconds(10 * i), &CongestionControl::OnData, cc, MilliSeconds(100));
+  }
+
+  // concave growth towards the window before the congestion event
+  Simulator::Stop(MilliSeconds(2005));
+  Simulator::Run();
+  BOOST_CHECK_GT(cc->GetWindow(), 85);
+  BOOST_CHECK_LT(cc->GetWindow(), 95);
+
+  // plateau
+  Simulator::Stop(MilliSeconds(2200));
+  Simulator::Run();
+  BOOST_CHECK_GT(cc->GetWindow(), 95);
+  BOOST_CHECK_LT(cc->GetWindow(), 101);
+
+  // convex probing beyond it
+  Simulator::Stop(MilliSeconds(3800));
+  Simulator::Run();
+  BOOST_CHECK_GT(cc->GetWindow(), 105);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,76 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "utils/ndn-interest-factory.hpp"
+
+#include <set>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsNdnInterestFactory, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(SameAsGenericConstruction)
+{
+  InterestFactory factory(CreateObject<UniformRandomVariable>());
+
+  Name prefix("/conference/producer/delta");
+  for (uint64_t seq : {0ull, 1ull, 252ull, 253ull, 65535ull, 65536ull, 4294967296ull}) {
+    shared_ptr<Interest> interest = factory.start(prefix)
+                                      .appendSequenceNumber(seq)
+                                      .append(name::Component("paired-key"))
+                                      .appendSequenceNumber(7)
+                                      .build(Seconds(2));
+
+    Name expected(prefix);
+    expected.appendSequenceNumber(seq).append("paired-key").appendSequenceNumber(7);
+    BOOST_CHECK_EQUAL(interest->getName(), expected);
+    BOOST_CHECK(interest->getName().wireEncode() == expected.wireEncode());
+    BOOST_CHECK_EQUAL(interest->getName().at(-3).toSequenceNumber(), seq);
+    BOOST_CHECK_EQUAL(interest->getInterestLifetime(), time::seconds(2));
+  }
+
+  // prefix change
+  shared_ptr<Interest> interest = factory.start("/other").appendSequenceNumber(1).build(Seconds(1));
+  BOOST_CHECK_EQUAL(interest->getName(), Name("/other").appendSequenceNumber(1));
+  BOOST_CHECK_EQUAL(interest->getInterestLifetime(), time::seconds(1));
+
+  // empty prefix
+  interest = factory.start(Name()).build(Seconds(1));
+  BOOST_CHECK_EQUAL(interest->getName(), Name());
+}
+
+BOOST_AUTO_TEST_CASE(Nonces)
+{
+  InterestFactory factory(CreateObject<UniformRandomVariable>());
+
+  std::set<uint32_t> nonces;
+  for (int i = 0; i < 1000; ++i) {
+    nonces.insert(factory.build("/prefix", Seconds(1))->getNonce());
+  }
+  BOOST_CHECK_GT(nonces.size(), 995);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,99 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-rtc-name.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsNdnRtcName, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(BuildAndParse)
+{
+  RtcNamespace ns("/conference/producer");
+  BOOST_CHECK_EQUAL(ns.getDiscoveryName(), Name("/conference/producer/discovery"));
+  BOOST_CHECK_EQUAL(ns.getKeyPrefix(), Name("/conference/producer/key"));
+  BOOST_CHECK_EQUAL(ns.getDeltaPrefix(), Name("/conference/producer/delta"));
+
+  Name delta = ns.getDeltaFrameName(12, 3);
+  BOOST_CHECK_EQUAL(delta, Name("/conference/producer/delta")
+                             .appendSequenceNumber(12).append("paired-key").appendSequenceNumber(3));
+
+  RtcName parsed = ns.parse(Name(delta).appendSequenceNumber(4));
+  BOOST_CHECK_EQUAL(parsed.type, RTC_FRAME_DELTA);
+  BOOST_CHECK_EQUAL(parsed.deltaId, 12);
+  BOOST_CHECK_EQUAL(parsed.keyId, 3);
+  BOOST_CHECK_EQUAL(parsed.segment, 4);
+  BOOST_CHECK(!parsed.isFrame());
+  BOOST_CHECK(ns.parse(delta).isFrame());
+  BOOST_CHECK(parsed.isSameFrame(ns.parse(delta)));
+  BOOST_CHECK(!parsed.isSameFrame(ns.parse(ns.getDeltaFrameName(13, 3))));
+
+  parsed = ns.parse(RtcNamespace::getParityName(delta, 1));
+  BOOST_CHECK_EQUAL(parsed.type, RTC_FRAME_DELTA);
+  BOOST_CHECK_EQUAL(parsed.deltaId, 12);
+  BOOST_CHECK_EQUAL(parsed.keyId, 3);
+  BOOST_CHECK(!parsed.hasSegment());
+  BOOST_CHECK_EQUAL(parsed.parity, 1);
+  BOOST_CHECK(parsed.isSameFrame(ns.parse(delta)));
+
+  parsed = ns.parse(Name(RtcNamespace::getLayerName(delta, 2)).appendSequenceNumber(1));
+  BOOST_CHECK_EQUAL(parsed.type, RTC_FRAME_DELTA);
+  BOOST_CHECK_EQUAL(parsed.deltaId, 12);
+  BOOST_CHECK_EQUAL(parsed.keyId, 3);
+  BOOST_CHECK_EQUAL(parsed.layer, 2);
+  BOOST_CHECK_EQUAL(parsed.segment, 1);
+  BOOST_CHECK(!parsed.isFrame());
+  BOOST_CHECK(parsed.isSameFrame(ns.parse(delta)));
+  BOOST_CHECK_EQUAL(RtcNamespace::getLayerName(delta, 0), delta);
+
+  parsed = ns.parse(ns.getKeyFrameName(7));
+  BOOST_CHECK_EQUAL(parsed.type, RTC_FRAME_KEY);
+  BOOST_CHECK_EQUAL(parsed.keyId, 7);
+  BOOST_CHECK_EQUAL(parsed.deltaId, RtcName::NONE);
+  BOOST_CHECK(!parsed.hasSegment());
+  BOOST_CHECK(parsed.isFrame());
+
+  parsed = ns.parse(Name(ns.getDiscoveryName()).appendSequenceNumber(7).appendSequenceNumber(20));
+  BOOST_CHECK_EQUAL(parsed.type, RTC_FRAME_DISCOVERY);
+  BOOST_CHECK_EQUAL(parsed.keyId, 7);
+  BOOST_CHECK_EQUAL(parsed.deltaId, 20);
+  BOOST_CHECK(!parsed.isFrame());
+
+  // malformed names are parsed up to the first unexpected component
+  parsed = ns.parse(Name(ns.getDeltaPrefix()).appendSequenceNumber(1).append("other"));
+  BOOST_CHECK_EQUAL(parsed.type, RTC_FRAME_DELTA);
+  BOOST_CHECK_EQUAL(parsed.deltaId, 1);
+  BOOST_CHECK_EQUAL(parsed.keyId, RtcName::NONE);
+  BOOST_CHECK(!parsed.isFrame());
+  BOOST_CHECK_EQUAL(ns.parse("/conference/producer/audio/1").type, RTC_FRAME_UNKNOWN);
+  BOOST_CHECK_EQUAL(ns.parse("/conference").type, RTC_FRAME_UNKNOWN);
+
+  BOOST_CHECK(ns.isTypePrefix("/conference/producer/delta"));
+  BOOST_CHECK(ns.isTypePrefix("/conference/producer/discovery"));
+  BOOST_CHECK(!ns.isTypePrefix("/conference/other/delta"));
+  BOOST_CHECK(!ns.isTypePrefix(delta));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,107 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-rtc-pipeline-control.hpp"
+
+#include "ns3/uinteger.h"
+#include "ns3/double.h"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsNdnRtcPipelineControl, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(Ewma)
+{
+  Ptr<RtcPipelineControl> pc = CreateObject<RtcPipelineControlEwma>();
+  pc->Reset(MilliSeconds(30), MilliSeconds(100));
+  BOOST_CHECK_EQUAL(pc->GetLambda(), 4);
+
+  // cached Data does not say anything about the distance to the producer
+  pc->OnData(MilliSeconds(10), false, false);
+  BOOST_CHECK_EQUAL(pc->GetLambda(), 4);
+
+  // average goes up to 165.6ms
+  for (int i = 0; i < 8; ++i) {
+    pc->OnData(MilliSeconds(200), true, false);
+  }
+  BOOST_CHECK_EQUAL(pc->GetLambda(), 6);
+
+  // average of 194.9ms would require 7, but Data is marked
+  pc->OnData(MilliSeconds(400), true, true);
+  BOOST_CHECK_EQUAL(pc->GetLambda(), 6);
+
+  // same congestion event
+  pc->OnTimeout();
+  BOOST_CHECK_EQUAL(pc->GetLambda(), 6);
+
+  Simulator::Stop(Seconds(1));
+  Simulator::Run();
+  pc->OnTimeout();
+  BOOST_CHECK_EQUAL(pc->GetLambda(), 5);
+
+  // average of 171.8ms would require 6, but lambda cannot grow right after the timeout
+  pc->OnData(MilliSeconds(10), true, false);
+  BOOST_CHECK_EQUAL(pc->GetLambda(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(MinDrd)
+{
+  Ptr<RtcPipelineControl> pc = CreateObject<RtcPipelineControlMinDrd>();
+  pc->SetAttribute("Window", TimeValue(Seconds(1)));
+  pc->Reset(MilliSeconds(30), MilliSeconds(100));
+  BOOST_CHECK_EQUAL(pc->GetLambda(), 4);
+
+  pc->OnData(MilliSeconds(50), true, false);
+  pc->OnData(MilliSeconds(150), true, false);
+  BOOST_CHECK_EQUAL(pc->GetLambda(), 2);
+
+  // samples of the first second have left the window
+  Simulator::Schedule(MilliSeconds(1500), &RtcPipelineControl::OnData, pc, MilliSeconds(200),
+                      true, false);
+  Simulator::Stop(Seconds(2));
+  Simulator::Run();
+  BOOST_CHECK_EQUAL(pc->GetLambda(), 7);
+}
+
+BOOST_AUTO_TEST_CASE(Percentile)
+{
+  Ptr<RtcPipelineControl> pc = CreateObject<RtcPipelineControlPercentile>();
+  pc->SetAttribute("HistorySize", UintegerValue(10));
+  pc->SetAttribute("Percentile", DoubleValue(90));
+  pc->Reset(MilliSeconds(30), MilliSeconds(100));
+  BOOST_CHECK_EQUAL(pc->GetLambda(), 4);
+
+  // 15, 25, ..., 95ms and 100ms: 90th percentile is 95ms
+  for (int drd = 15; drd < 100; drd += 10) {
+    pc->OnData(MilliSeconds(drd), true, false);
+  }
+  BOOST_CHECK_EQUAL(pc->GetLambda(), 4);
+
+  // 100ms is pushed out of the history: 90th percentile is 85ms
+  pc->OnData(MilliSeconds(5), true, false);
+  BOOST_CHECK_EQUAL(pc->GetLambda(), 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
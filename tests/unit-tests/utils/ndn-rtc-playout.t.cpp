@@ -0,0 +1,103 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-rtc-playout.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class RtcPlayoutFixture : public CleanupFixture
+{
+public:
+  RtcPlayoutFixture()
+    : registry(RtcFrameRegistry::getRegistry("/conference/producer"))
+    , playout(CreateObject<RtcPlayout>())
+  {
+    playout->SetAttribute("PlayoutDelay", TimeValue(MilliSeconds(20)));
+    playout->TraceConnectWithoutContext("FrameDisplayed",
+                                        MakeCallback(&RtcPlayoutFixture::onDisplayed, this));
+    playout->Start(registry, MilliSeconds(10));
+  }
+
+  /**
+   * @brief Record frame generated at @p generationTime, deliver its segments at @p arrivalTime
+   */
+  void
+  addFrame(const Name& frameName, Time generationTime, uint32_t nSegments, Time arrivalTime)
+  {
+    registry->recordFrame(frameName, generationTime, nSegments);
+    for (uint32_t i = 0; i < nSegments; ++i) {
+      RtcName segment = registry->getNamespace().parse(Name(frameName).appendSequenceNumber(i));
+      Simulator::Schedule(arrivalTime, &RtcPlayout::OnSegment, playout, segment);
+    }
+  }
+
+private:
+  void
+  onDisplayed(const Name& frame, Time latency)
+  {
+    displayed.push_back(std::make_pair(frame, latency));
+  }
+
+public:
+  shared_ptr<RtcFrameRegistry> registry;
+  Ptr<RtcPlayout> playout;
+  std::vector<std::pair<Name, Time>> displayed;
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsNdnRtcPlayout, RtcPlayoutFixture)
+
+BOOST_AUTO_TEST_CASE(StallAndSkip)
+{
+  const RtcNamespace& ns = registry->getNamespace();
+  addFrame(ns.getKeyFrameName(0), MilliSeconds(0), 2, MilliSeconds(3));
+  addFrame(ns.getDeltaFrameName(0, 0), MilliSeconds(10), 1, MilliSeconds(13));
+  // frame 2 is never received
+  registry->recordFrame(ns.getDeltaFrameName(1, 0), MilliSeconds(20), 1);
+  addFrame(ns.getDeltaFrameName(2, 0), MilliSeconds(30), 1, MilliSeconds(33));
+  addFrame(ns.getKeyFrameName(1), MilliSeconds(40), 2, MilliSeconds(70));
+  addFrame(ns.getDeltaFrameName(0, 1), MilliSeconds(50), 1, MilliSeconds(53));
+
+  Simulator::Stop(MilliSeconds(200));
+  Simulator::Run();
+
+  // playout starts at 23ms, stalls at 43ms waiting for frame 2, and resumes at 90ms (key
+  // frame complete at 70ms + 20ms of buffering), skipping frames 2 and 3
+  BOOST_REQUIRE_EQUAL(displayed.size(), 4);
+  BOOST_CHECK_EQUAL(displayed[0].first, ns.getKeyFrameName(0));
+  BOOST_CHECK_EQUAL(displayed[0].second, MilliSeconds(23));
+  BOOST_CHECK_EQUAL(displayed[1].first, ns.getDeltaFrameName(0, 0));
+  BOOST_CHECK_EQUAL(displayed[1].second, MilliSeconds(23));
+  BOOST_CHECK_EQUAL(displayed[2].first, ns.getKeyFrameName(1));
+  BOOST_CHECK_EQUAL(displayed[2].second, MilliSeconds(50));
+  BOOST_CHECK_EQUAL(displayed[3].first, ns.getDeltaFrameName(0, 1));
+  BOOST_CHECK_EQUAL(displayed[3].second, MilliSeconds(50));
+
+  BOOST_CHECK_EQUAL(playout->GetNSkippedFrames(), 2);
+  // the second stall (no more frames) has not ended
+  BOOST_CHECK_EQUAL(playout->GetNStalls(), 2);
+  BOOST_CHECK_EQUAL(playout->GetTotalStallTime(), MilliSeconds(47));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
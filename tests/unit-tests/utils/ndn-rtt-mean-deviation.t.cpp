@@ -0,0 +1,59 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "utils/ndn-rtt-mean-deviation.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsNdnRttMeanDeviation, CleanupFixture)
+
+static void
+advanceTime(Time delay)
+{
+  Simulator::Stop(delay);
+  Simulator::Run();
+}
+
+BOOST_AUTO_TEST_CASE(OutOfOrderAcks)
+{
+  Ptr<RttEstimator> rtt = CreateObject<RttMeanDeviation>();
+
+  rtt->SentSeq(SequenceNumber32(1), 1);
+  rtt->SentSeq(SequenceNumber32(2), 1);
+  rtt->SentSeq(SequenceNumber32(3), 1);
+  rtt->SentSeq(SequenceNumber32(3), 1); // retransmission
+
+  advanceTime(Seconds(0.1));
+  BOOST_CHECK_EQUAL(rtt->AckSeq(SequenceNumber32(2)), Seconds(0.1));
+  BOOST_CHECK_EQUAL(rtt->GetCurrentEstimate(), Seconds(0.1));
+
+  advanceTime(Seconds(0.1));
+  BOOST_CHECK_EQUAL(rtt->AckSeq(SequenceNumber32(1)), Seconds(0.2)); // earlier seq, acked later
+  BOOST_CHECK_EQUAL(rtt->AckSeq(SequenceNumber32(3)), Seconds(0));   // Karn's rule
+  BOOST_CHECK_EQUAL(rtt->AckSeq(SequenceNumber32(2)), Seconds(0));   // already acked
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,97 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "utils/ndn-seq-state-table.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsNdnSeqStateTable, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(SendAndErase)
+{
+  SeqStateTable table;
+
+  // enough records to force several table resizes
+  for (uint32_t seq = 0; seq < 1000; ++seq) {
+    table.onSent(seq, Seconds(1));
+  }
+  table.onSent(10, Seconds(2));
+  BOOST_CHECK_EQUAL(table.size(), 1000);
+  BOOST_CHECK_EQUAL(table.getNPendingTimeouts(), 1000);
+
+  SeqStateTable::Entry* entry = table.find(10);
+  BOOST_REQUIRE(entry != nullptr);
+  BOOST_CHECK_EQUAL(entry->firstSent, Seconds(1));
+  BOOST_CHECK_EQUAL(entry->lastSent, Seconds(2));
+  BOOST_CHECK_EQUAL(entry->timeoutStart, Seconds(1)); // timeout was already pending
+  BOOST_CHECK_EQUAL(entry->retxCount, 2);
+
+  for (uint32_t seq = 0; seq < 1000; seq += 2) {
+    table.erase(seq);
+  }
+  BOOST_CHECK_EQUAL(table.size(), 500);
+  for (uint32_t seq = 0; seq < 1000; ++seq) {
+    BOOST_CHECK_EQUAL(table.find(seq) != nullptr, seq % 2 == 1);
+  }
+  BOOST_CHECK(table.find(1000) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(TimeoutsAndRetx)
+{
+  SeqStateTable table;
+  table.onSent(5, Seconds(1));
+  table.onSent(3, Seconds(2));
+  table.onSent(7, Seconds(3));
+  table.erase(3);
+
+  BOOST_REQUIRE(table.hasPendingTimeouts());
+  BOOST_CHECK_EQUAL(table.getEarliestTimeout().seq, 5);
+  BOOST_CHECK_EQUAL(table.popEarliestTimeout(), 5);
+  BOOST_CHECK_EQUAL(table.getEarliestTimeout().seq, 7);
+  BOOST_CHECK_EQUAL(table.popEarliestTimeout(), 7);
+  BOOST_CHECK(!table.hasPendingTimeouts());
+
+  table.scheduleRetx(7);
+  table.scheduleRetx(5);
+  table.scheduleRetx(5);
+  table.scheduleRetx(3); // no record
+  BOOST_REQUIRE(table.hasPendingRetx());
+  BOOST_CHECK_EQUAL(table.popRetx(), 5);
+
+  table.scheduleRetx(5);
+  table.erase(5); // Data received
+  BOOST_REQUIRE(table.hasPendingRetx());
+  BOOST_CHECK_EQUAL(table.popRetx(), 7);
+  BOOST_CHECK(!table.hasPendingRetx());
+
+  // retransmission restarts the timeout
+  table.onSent(7, Seconds(4));
+  BOOST_REQUIRE(table.hasPendingTimeouts());
+  BOOST_CHECK_EQUAL(table.getEarliestTimeout().timeoutStart, Seconds(4));
+  BOOST_CHECK_EQUAL(table.getEarliestTimeout().retxCount, 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
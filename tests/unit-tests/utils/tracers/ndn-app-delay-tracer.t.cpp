@@ -157,6 +157,66 @@ BOOST_AUTO_TEST_CASE(InstallNodeDumpStream)
     "3.02088	2	0	1	FullDelay	0.0208832	20883.2	1	1\n"));
 }
 
+BOOST_AUTO_TEST_CASE(InstallAggregated)
+{
+  NodeContainer nodes;
+  nodes.Add(getNode("2"));
+
+  AppDelayTracer::InstallAggregated(nodes, TEST_TRACE.string());
+
+  Simulator::Stop(Seconds(4));
+  Simulator::Run();
+
+  AppDelayTracer::Destroy(); // to force summary to be written
+
+  std::ifstream t(TEST_TRACE.string().c_str());
+  std::stringstream buffer;
+  buffer << t.rdbuf();
+
+  // 20883us falls into [20736, 20991] bucket, represented by 20863
+  BOOST_CHECK_EQUAL(buffer.str(),
+    "Time	Node	AppId	Type	Metric	Count	Min	Mean	P50	P90	P95	P99	P99.9	Max\n"
+    "4	2	0	LastDelay	DelayUS	2	0	10441.5	0	20863	20863	20863	20863	20883\n"
+    "4	2	0	LastDelay	HopCount	2	0	0.5	0	1	1	1	1	1\n"
+    "4	2	0	FullDelay	DelayUS	2	0	10441.5	0	20863	20863	20863	20863	20883\n"
+    "4	2	0	FullDelay	RetxCount	2	1	1	1	1	1	1	1	1\n"
+    "4	2	0	FullDelay	HopCount	2	0	0.5	0	1	1	1	1	1\n");
+}
+
+BOOST_AUTO_TEST_CASE(InstallAggregatedPeriodic)
+{
+  AppDelayTracer::InstallAggregatedAll(TEST_TRACE.string(), Seconds(1), false);
+
+  Simulator::Stop(Seconds(4));
+  Simulator::Run();
+
+  AppDelayTracer::Destroy(); // to force summary to be written
+
+  std::ifstream t(TEST_TRACE.string().c_str());
+  std::stringstream buffer;
+  buffer << t.rdbuf();
+
+  // each summary covers only samples since the previous one (sample received at 2s is
+  // processed after the summary scheduled for the same time)
+  BOOST_CHECK_EQUAL(buffer.str(),
+    "Time	Node	AppId	Type	Metric	Count	Min	Mean	P50	P90	P95	P99	P99.9	Max\n"
+    "1	1	all	LastDelay	DelayUS	1	41766	41766	41766	41766	41766	41766	41766	41766\n"
+    "1	1	all	LastDelay	HopCount	1	2	2	2	2	2	2	2	2\n"
+    "1	1	all	FullDelay	DelayUS	1	41766	41766	41766	41766	41766	41766	41766	41766\n"
+    "1	1	all	FullDelay	RetxCount	1	1	1	1	1	1	1	1	1\n"
+    "1	1	all	FullDelay	HopCount	1	2	2	2	2	2	2	2	2\n"
+    "3	2	all	LastDelay	DelayUS	1	0	0	0	0	0	0	0	0\n"
+    "3	2	all	LastDelay	HopCount	1	0	0	0	0	0	0	0	0\n"
+    "3	2	all	FullDelay	DelayUS	1	0	0	0	0	0	0	0	0\n"
+    "3	2	all	FullDelay	RetxCount	1	1	1	1	1	1	1	1	1\n"
+    "3	2	all	FullDelay	HopCount	1	0	0	0	0	0	0	0	0\n"
+    "4	2	all	LastDelay	DelayUS	1	20883	20883	20883	20883	20883	20883	20883	20883\n"
+    "4	2	all	LastDelay	HopCount	1	1	1	1	1	1	1	1	1\n"
+    "4	2	all	FullDelay	DelayUS	1	20883	20883	20883	20883	20883	20883	20883	20883\n"
+    "4	2	all	FullDelay	RetxCount	1	1	1	1	1	1	1	1	1\n"
+    "4	2	all	FullDelay	HopCount	1	1	1	1	1	1	1	1	1\n");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
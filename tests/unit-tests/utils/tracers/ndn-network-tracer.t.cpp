@@ -0,0 +1,117 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/tracers/ndn-network-tracer.hpp"
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+const boost::filesystem::path TEST_TRACE = boost::filesystem::path(TEST_CONFIG_PATH) / "network-trace.bin";
+
+class NetworkTracerFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  NetworkTracerFixture()
+  {
+    boost::filesystem::create_directories(TEST_CONFIG_PATH);
+
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+    Config::SetDefault("ns3::QueueBase::MaxPackets", UintegerValue(20));
+
+    createTopology({
+        {"1", "2"},
+      });
+
+    addRoutes({
+        {"1", "2", "/prefix", 1},
+      });
+
+    addApps({
+        {"1", "ns3::ndn::ConsumerCbr",
+            {{"Prefix", "/prefix"}, {"Frequency", "10"}},
+            "0s", "0.95s"},
+        {"2", "ns3::ndn::Producer",
+            {{"Prefix", "/prefix"}, {"PayloadSize", "1024"}},
+            "0s", "100s"}
+      });
+  }
+
+  ~NetworkTracerFixture()
+  {
+    boost::filesystem::remove(TEST_TRACE);
+    NetworkTracer::Destroy(); // additional cleanup
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTracersNdnNetworkTracer, NetworkTracerFixture)
+
+BOOST_AUTO_TEST_CASE(Snapshot)
+{
+  NetworkTracer::InstallAll(TEST_TRACE.string(), Seconds(1));
+
+  Simulator::Stop(Seconds(2.5));
+  Simulator::Run();
+
+  NetworkTracer::Destroy(); // to force all blocks to be written
+
+  std::ifstream is(TEST_TRACE.string().c_str(), std::ios_base::binary);
+  BOOST_REQUIRE(is.is_open());
+
+  for (int block = 1; block <= 2; ++block) {
+    NetworkTracer::BlockHeader header;
+    is.read(reinterpret_cast<char*>(&header), sizeof(header));
+    BOOST_REQUIRE(is);
+    BOOST_CHECK_EQUAL(header.magic, NetworkTracer::MAGIC);
+    BOOST_CHECK_EQUAL(header.time, block);
+    BOOST_REQUIRE_EQUAL(header.nNodes, 2);
+
+    for (uint32_t i = 0; i < header.nNodes; ++i) {
+      NetworkTracer::NodeRecord node;
+      is.read(reinterpret_cast<char*>(&node), sizeof(node));
+      BOOST_REQUIRE(is);
+
+      for (uint32_t j = 0; j < node.nFaces; ++j) {
+        NetworkTracer::FaceRecord face;
+        is.read(reinterpret_cast<char*>(&face), sizeof(face));
+        BOOST_REQUIRE(is);
+
+        if (node.node == getNode("1")->GetId() && face.faceId == getFace("1", "2")->getId()) {
+          BOOST_CHECK_EQUAL(face.nOutInterests, 10);
+          BOOST_CHECK_EQUAL(face.nInData, 10);
+          BOOST_CHECK_GT(face.nInBytes, 10 * 1024);
+        }
+      }
+    }
+  }
+
+  // no more blocks
+  char c;
+  BOOST_CHECK(!is.read(&c, 1));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,110 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "ndn-alias-sampler.hpp"
+
+#include "ns3/assert.h"
+
+#include <cmath>
+#include <map>
+#include <numeric>
+#include <tuple>
+
+namespace ns3 {
+namespace ndn {
+
+AliasSampler::AliasSampler(const std::vector<double>& weights)
+  : m_prob(weights.size())
+  , m_alias(weights.size())
+{
+  NS_ASSERT(!weights.empty());
+
+  size_t n = weights.size();
+  double sum = std::accumulate(weights.begin(), weights.end(), 0.0);
+
+  // Vose's variant of the alias method: split columns into underfull and overfull ones and
+  // fill each underfull column with the excess of an overfull one
+  std::vector<uint32_t> small;
+  std::vector<uint32_t> large;
+  for (size_t i = 0; i < n; ++i) {
+    m_prob[i] = weights[i] * n / sum;
+    m_alias[i] = i;
+    if (m_prob[i] < 1.0) {
+      small.push_back(i);
+    }
+    else {
+      large.push_back(i);
+    }
+  }
+
+  while (!small.empty() && !large.empty()) {
+    uint32_t less = small.back();
+    small.pop_back();
+    uint32_t more = large.back();
+
+    m_alias[less] = more;
+    m_prob[more] = (m_prob[more] + m_prob[less]) - 1.0;
+    if (m_prob[more] < 1.0) {
+      large.pop_back();
+      small.push_back(more);
+    }
+  }
+
+  // leftovers are full columns (up to the floating point error)
+  for (uint32_t i : small) {
+    m_prob[i] = 1.0;
+  }
+  for (uint32_t i : large) {
+    m_prob[i] = 1.0;
+  }
+}
+
+shared_ptr<const AliasSampler>
+AliasSampler::getZipfMandelbrot(uint32_t n, double q, double s)
+{
+  typedef std::tuple<uint32_t, double, double> Key;
+  static std::map<Key, std::weak_ptr<const AliasSampler>> cache;
+
+  std::weak_ptr<const AliasSampler>& cached = cache[Key(n, q, s)];
+  shared_ptr<const AliasSampler> sampler = cached.lock();
+  if (sampler == nullptr) {
+    std::vector<double> weights(n);
+    for (uint32_t i = 0; i < n; ++i) {
+      weights[i] = 1.0 / std::pow(i + 1 + q, s);
+    }
+    sampler = make_shared<AliasSampler>(weights);
+    cached = sampler;
+  }
+
+  // drop entries of tables that are no longer used
+  for (auto i = cache.begin(); i != cache.end();) {
+    if (i->second.expired()) {
+      i = cache.erase(i);
+    }
+    else {
+      ++i;
+    }
+  }
+
+  return sampler;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,89 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#ifndef NDN_ALIAS_SAMPLER_H
+#define NDN_ALIAS_SAMPLER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief Immutable sampler of a discrete distribution using Walker's alias method
+ *
+ * The table is built once in O(N) and each draw is O(1), independent of the number of
+ * outcomes.  Tables for commonly used distributions are cached process-wide, so that all
+ * workload generators with identical parameters share a single table.
+ */
+class AliasSampler {
+public:
+  /**
+   * @brief Build sampler for outcomes 0..weights.size()-1 with probabilities proportional to
+   *        @p weights
+   */
+  explicit AliasSampler(const std::vector<double>& weights);
+
+  /**
+   * @brief Get (shared) sampler of Zipf-Mandelbrot distribution
+   *
+   * Outcome k (0-based) has probability proportional to 1 / (k + 1 + q)^s.  The returned table
+   * is shared with all other users of the same (@p n, @p q, @p s) and is released when the
+   * last user releases it.
+   */
+  static shared_ptr<const AliasSampler>
+  getZipfMandelbrot(uint32_t n, double q, double s);
+
+  /**
+   * @brief Draw an outcome
+   * @param u uniformly distributed random value in [0, 1)
+   */
+  uint32_t
+  sample(double u) const
+  {
+    double x = u * m_prob.size();
+    uint32_t i = static_cast<uint32_t>(x);
+    if (i >= m_prob.size()) { // u == 1
+      i = m_prob.size() - 1;
+    }
+    return (x - i < m_prob[i]) ? i : m_alias[i];
+  }
+
+  /**
+   * @brief Number of outcomes
+   */
+  size_t
+  size() const
+  {
+    return m_prob.size();
+  }
+
+private:
+  std::vector<double> m_prob;    ///< @brief probability to keep the column's own outcome
+  std::vector<uint32_t> m_alias; ///< @brief alternative outcome of the column
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_ALIAS_SAMPLER_H
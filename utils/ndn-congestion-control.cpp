@@ -0,0 +1,366 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-congestion-control.hpp"
+
+#include "ns3/simulator.h"
+#include "ns3/double.h"
+#include "ns3/boolean.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+NS_LOG_COMPONENT_DEFINE("ndn.CongestionControl");
+
+namespace ns3 {
+namespace ndn {
+
+NS_OBJECT_ENSURE_REGISTERED(CongestionControl);
+NS_OBJECT_ENSURE_REGISTERED(CongestionControlAimd);
+NS_OBJECT_ENSURE_REGISTERED(CongestionControlCubic);
+NS_OBJECT_ENSURE_REGISTERED(CongestionControlVegas);
+
+TypeId
+CongestionControl::GetTypeId()
+{
+  static TypeId tid =
+    TypeId("ns3::ndn::CongestionControl")
+      .SetGroupName("Ndn")
+      .SetParent<Object>()
+      .AddAttribute("MinWindow", "Lower bound of the congestion window", DoubleValue(1.0),
+                    MakeDoubleAccessor(&CongestionControl::m_minWindow),
+                    MakeDoubleChecker<double>(0.0))
+      .AddAttribute("InitialSsthresh", "Initial slow start threshold (unlimited by default)",
+                    DoubleValue(std::numeric_limits<double>::max()),
+                    MakeDoubleAccessor(&CongestionControl::m_initialSsthresh),
+                    MakeDoubleChecker<double>(0.0))
+
+      .AddTraceSource("CongestionWindow", "Congestion window (before rounding)",
+                      MakeTraceSourceAccessor(&CongestionControl::m_window),
+                      "ns3::TracedValueCallback::Double");
+  return tid;
+}
+
+CongestionControl::CongestionControl()
+  : m_initialWindow(1.0)
+  , m_minWindow(1.0)
+  , m_ssthresh(std::numeric_limits<double>::max())
+  , m_initialSsthresh(std::numeric_limits<double>::max())
+  , m_window(1.0)
+{
+}
+
+void
+CongestionControl::Reset(double initialWindow)
+{
+  m_initialWindow = initialWindow;
+  m_ssthresh = m_initialSsthresh;
+  m_srtt = Time(0);
+  m_minRtt = Time(0);
+  m_recoveryEnd = Time(0);
+  m_window = initialWindow;
+}
+
+void
+CongestionControl::SetWindow(double window)
+{
+  m_window = std::max(window, m_minWindow);
+}
+
+void
+CongestionControl::OnData(Time rtt)
+{
+  UpdateRtt(rtt);
+  IncreaseWindow(rtt);
+}
+
+void
+CongestionControl::OnCongestionMark(Time rtt)
+{
+  // marked Data never grows the window, even if the decrease itself is suppressed
+  UpdateRtt(rtt);
+  OnCongestionEvent();
+}
+
+void
+CongestionControl::OnTimeout()
+{
+  OnCongestionEvent();
+}
+
+void
+CongestionControl::OnNack()
+{
+  OnCongestionEvent();
+}
+
+void
+CongestionControl::UpdateRtt(Time rtt)
+{
+  if (rtt.IsStrictlyPositive()) {
+    m_srtt = m_srtt.IsZero() ? rtt : m_srtt + (rtt - m_srtt) / 8;
+    if (m_minRtt.IsZero() || rtt < m_minRtt) {
+      m_minRtt = rtt;
+    }
+  }
+}
+
+void
+CongestionControl::OnCongestionEvent()
+{
+  Time now = Simulator::Now();
+  if (now < m_recoveryEnd) {
+    NS_LOG_DEBUG("Congestion event within one RTT of the previous one, ignoring");
+    return;
+  }
+
+  DecreaseWindow();
+  m_recoveryEnd = now + m_srtt;
+  NS_LOG_DEBUG("Window decreased to " << m_window << ", ssthresh " << m_ssthresh);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TypeId
+CongestionControlAimd::GetTypeId()
+{
+  static TypeId tid =
+    TypeId("ns3::ndn::CongestionControlAimd")
+      .SetGroupName("Ndn")
+      .SetParent<CongestionControl>()
+      .AddConstructor<CongestionControlAimd>()
+      .AddAttribute("AdditiveIncrease", "Window increase per window's worth of Data",
+                    DoubleValue(1.0),
+                    MakeDoubleAccessor(&CongestionControlAimd::m_additiveIncrease),
+                    MakeDoubleChecker<double>(0.0))
+      .AddAttribute("Beta", "Multiplicative decrease factor", DoubleValue(0.5),
+                    MakeDoubleAccessor(&CongestionControlAimd::m_beta),
+                    MakeDoubleChecker<double>(0.0, 1.0));
+  return tid;
+}
+
+CongestionControlAimd::CongestionControlAimd()
+  : m_additiveIncrease(1.0)
+  , m_beta(0.5)
+{
+}
+
+void
+CongestionControlAimd::IncreaseWindow(Time rtt)
+{
+  if (GetWindow() < m_ssthresh) {
+    SetWindow(GetWindow() + 1.0);
+  }
+  else {
+    SetWindow(GetWindow() + m_additiveIncrease / GetWindow());
+  }
+}
+
+void
+CongestionControlAimd::DecreaseWindow()
+{
+  m_ssthresh = std::max(GetWindow() * m_beta, m_minWindow);
+  SetWindow(m_ssthresh);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TypeId
+CongestionControlCubic::GetTypeId()
+{
+  static TypeId tid =
+    TypeId("ns3::ndn::CongestionControlCubic")
+      .SetGroupName("Ndn")
+      .SetParent<CongestionControl>()
+      .AddConstructor<CongestionControlCubic>()
+      .AddAttribute("C", "Scaling constant of the cubic function", DoubleValue(0.4),
+                    MakeDoubleAccessor(&CongestionControlCubic::m_c),
+                    MakeDoubleChecker<double>(0.0))
+      .AddAttribute("Beta", "Multiplicative decrease factor", DoubleValue(0.7),
+                    MakeDoubleAccessor(&CongestionControlCubic::m_beta),
+                    MakeDoubleChecker<double>(0.0, 1.0))
+      .AddAttribute("FastConvergence", "Release bandwidth faster when W_max keeps decreasing",
+                    BooleanValue(true),
+                    MakeBooleanAccessor(&CongestionControlCubic::m_fastConvergence),
+                    MakeBooleanChecker());
+  return tid;
+}
+
+CongestionControlCubic::CongestionControlCubic()
+  : m_c(0.4)
+  , m_beta(0.7)
+  , m_fastConvergence(true)
+  , m_wMax(0)
+  , m_wLastMax(0)
+  , m_k(0)
+  , m_epochStart(Seconds(-1))
+{
+}
+
+void
+CongestionControlCubic::Reset(double initialWindow)
+{
+  CongestionControl::Reset(initialWindow);
+  m_wMax = 0;
+  m_wLastMax = 0;
+  m_k = 0;
+  m_epochStart = Seconds(-1);
+}
+
+void
+CongestionControlCubic::IncreaseWindow(Time rtt)
+{
+  double window = GetWindow();
+  if (window < m_ssthresh) {
+    SetWindow(window + 1.0);
+    return;
+  }
+
+  Time now = Simulator::Now();
+  if (m_epochStart.IsNegative()) {
+    m_epochStart = now;
+    if (window < m_wMax) {
+      m_k = std::cbrt((m_wMax - window) / m_c);
+    }
+    else {
+      // e.g., slow start ended without a congestion event
+      m_k = 0;
+      m_wMax = window;
+    }
+  }
+
+  // target is the window one RTT from now
+  double t = (now - m_epochStart + m_minRtt).ToDouble(Time::S);
+  double target = m_c * std::pow(t - m_k, 3) + m_wMax;
+  if (target > window) {
+    SetWindow(window + (target - window) / window);
+  }
+  else {
+    SetWindow(window + 0.01 / window);
+  }
+}
+
+void
+CongestionControlCubic::DecreaseWindow()
+{
+  double window = GetWindow();
+  m_epochStart = Seconds(-1);
+
+  if (m_fastConvergence && window < m_wLastMax) {
+    m_wMax = window * (1.0 + m_beta) / 2.0;
+  }
+  else {
+    m_wMax = window;
+  }
+  m_wLastMax = window;
+
+  m_ssthresh = std::max(window * m_beta, m_minWindow);
+  SetWindow(m_ssthresh);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TypeId
+CongestionControlVegas::GetTypeId()
+{
+  static TypeId tid =
+    TypeId("ns3::ndn::CongestionControlVegas")
+      .SetGroupName("Ndn")
+      .SetParent<CongestionControl>()
+      .AddConstructor<CongestionControlVegas>()
+      .AddAttribute("Alpha", "Grow window if fewer Data are estimated to be queued",
+                    DoubleValue(2.0), MakeDoubleAccessor(&CongestionControlVegas::m_alpha),
+                    MakeDoubleChecker<double>(0.0))
+      .AddAttribute("Beta", "Shrink window if more Data are estimated to be queued",
+                    DoubleValue(4.0), MakeDoubleAccessor(&CongestionControlVegas::m_beta),
+                    MakeDoubleChecker<double>(0.0))
+      .AddAttribute("Gamma", "Leave slow start if more Data are estimated to be queued",
+                    DoubleValue(1.0), MakeDoubleAccessor(&CongestionControlVegas::m_gamma),
+                    MakeDoubleChecker<double>(0.0))
+      .AddAttribute("DecreaseFactor", "Multiplicative decrease factor on timeout or NACK",
+                    DoubleValue(0.5), MakeDoubleAccessor(&CongestionControlVegas::m_decreaseFactor),
+                    MakeDoubleChecker<double>(0.0, 1.0));
+  return tid;
+}
+
+CongestionControlVegas::CongestionControlVegas()
+  : m_alpha(2.0)
+  , m_beta(4.0)
+  , m_gamma(1.0)
+  , m_decreaseFactor(0.5)
+{
+}
+
+void
+CongestionControlVegas::Reset(double initialWindow)
+{
+  CongestionControl::Reset(initialWindow);
+  m_roundEnd = Time(0);
+  m_roundMinRtt = Time(0);
+}
+
+void
+CongestionControlVegas::IncreaseWindow(Time rtt)
+{
+  if (rtt.IsStrictlyPositive() && (m_roundMinRtt.IsZero() || rtt < m_roundMinRtt)) {
+    m_roundMinRtt = rtt;
+  }
+
+  Time now = Simulator::Now();
+  if (now < m_roundEnd || m_roundMinRtt.IsZero()) {
+    if (GetWindow() < m_ssthresh) {
+      SetWindow(GetWindow() + 1.0);
+    }
+    return;
+  }
+
+  // end of the measurement round
+  double diff = GetWindow() * (1.0 - m_minRtt.ToDouble(Time::S) / m_roundMinRtt.ToDouble(Time::S));
+  NS_LOG_DEBUG("Estimated queued Data: " << diff);
+
+  if (GetWindow() < m_ssthresh) {
+    if (diff > m_gamma) {
+      m_ssthresh = GetWindow();
+    }
+    else {
+      SetWindow(GetWindow() + 1.0);
+    }
+  }
+  else if (diff < m_alpha) {
+    SetWindow(GetWindow() + 1.0);
+  }
+  else if (diff > m_beta) {
+    SetWindow(GetWindow() - 1.0);
+  }
+
+  m_roundEnd = now + m_roundMinRtt;
+  m_roundMinRtt = Time(0);
+}
+
+void
+CongestionControlVegas::DecreaseWindow()
+{
+  m_ssthresh = std::max(GetWindow() * m_decreaseFactor, m_minWindow);
+  SetWindow(m_ssthresh);
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,231 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_CONGESTION_CONTROL_H
+#define NDN_CONGESTION_CONTROL_H
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/traced-value.h"
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief Base class of window-based congestion controllers of consumer applications
+ *
+ * The controller keeps a (fractional) congestion window, which the application rounds down
+ * to the number of Interests it allows to be outstanding.  The application notifies the
+ * controller about every received Data (with an RTT sample, if the Interest was not
+ * retransmitted), every retransmission timeout, and every congestion NACK.  Data that carries
+ * a congestion mark is reported separately.
+ *
+ * Timeouts, NACKs, and congestion marks are all treated as congestion signals.  To react only once to a burst of
+ * losses caused by the same congestion event, the window is decreased at most once per
+ * smoothed RTT.
+ */
+class CongestionControl : public Object {
+public:
+  static TypeId
+  GetTypeId();
+
+  CongestionControl();
+
+  /**
+   * @brief Reset controller state and set window to @p initialWindow
+   */
+  virtual void
+  Reset(double initialWindow);
+
+  double
+  GetWindow() const
+  {
+    return m_window;
+  }
+
+  /**
+   * @brief Notify about received Data
+   * @param rtt RTT sample, zero if Data is for a retransmitted Interest (Karn's algorithm)
+   */
+  void
+  OnData(Time rtt);
+
+  /**
+   * @brief Notify about received Data that carries a congestion mark
+   * @param rtt RTT sample, zero if Data is for a retransmitted Interest (Karn's algorithm)
+   */
+  void
+  OnCongestionMark(Time rtt);
+
+  /**
+   * @brief Notify about retransmission timeout of an Interest
+   */
+  void
+  OnTimeout();
+
+  /**
+   * @brief Notify about NACK with reason Congestion
+   */
+  void
+  OnNack();
+
+protected:
+  /**
+   * @brief Grow the window after Data is received
+   */
+  virtual void
+  IncreaseWindow(Time rtt) = 0;
+
+  /**
+   * @brief Shrink the window in response to a congestion event (timeout, NACK, or mark)
+   */
+  virtual void
+  DecreaseWindow() = 0;
+
+  void
+  SetWindow(double window);
+
+protected:
+  double m_initialWindow;
+  double m_minWindow;
+  double m_ssthresh; ///< @brief slow start threshold
+
+  Time m_srtt;   ///< @brief smoothed RTT, zero until the first sample
+  Time m_minRtt; ///< @brief minimum observed RTT, zero until the first sample
+
+private:
+  void
+  UpdateRtt(Time rtt);
+
+  void
+  OnCongestionEvent();
+
+private:
+  double m_initialSsthresh;
+  Time m_recoveryEnd; ///< @brief congestion events until this time are ignored
+
+  TracedValue<double> m_window;
+};
+
+/**
+ * @ingroup ndn-apps
+ * @brief Additive increase, multiplicative decrease (Reno-like) controller
+ *
+ * In slow start (window below the slow start threshold) the window grows by one per Data,
+ * otherwise by AdditiveIncrease per window's worth of Data.  On a congestion event, both the
+ * window and the threshold are set to Beta times the window.
+ */
+class CongestionControlAimd : public CongestionControl {
+public:
+  static TypeId
+  GetTypeId();
+
+  CongestionControlAimd();
+
+protected:
+  virtual void
+  IncreaseWindow(Time rtt);
+
+  virtual void
+  DecreaseWindow();
+
+private:
+  double m_additiveIncrease;
+  double m_beta;
+};
+
+/**
+ * @ingroup ndn-apps
+ * @brief CUBIC-like controller (RFC 8312, without TCP-friendly region)
+ *
+ * After a congestion event at window W_max, the window follows
+ * W(t) = C * (t - K)^3 + W_max with K = cbrt(W_max * (1 - Beta) / C), where t is the time since
+ * the event: it grows fast while far below W_max, plateaus around it, and probes for more
+ * bandwidth afterwards.
+ */
+class CongestionControlCubic : public CongestionControl {
+public:
+  static TypeId
+  GetTypeId();
+
+  CongestionControlCubic();
+
+  virtual void
+  Reset(double initialWindow);
+
+protected:
+  virtual void
+  IncreaseWindow(Time rtt);
+
+  virtual void
+  DecreaseWindow();
+
+private:
+  double m_c;
+  double m_beta;
+  bool m_fastConvergence;
+
+  double m_wMax;     ///< @brief window before the last congestion event
+  double m_wLastMax; ///< @brief m_wMax before the last congestion event
+  double m_k;
+  Time m_epochStart; ///< @brief start of the current growth epoch, negative if not started
+};
+
+/**
+ * @ingroup ndn-apps
+ * @brief Delay-based (Vegas-like) controller
+ *
+ * Once per RTT, the controller estimates the number of its own packets queued in the network
+ * as diff = window * (1 - minRtt / rtt), where rtt is the smallest sample of the last round.
+ * The window grows by one if diff is below Alpha, and shrinks by one if it is above Beta.  Slow
+ * start ends as soon as diff exceeds Gamma.  On a congestion event, the window is multiplied by
+ * DecreaseFactor.
+ */
+class CongestionControlVegas : public CongestionControl {
+public:
+  static TypeId
+  GetTypeId();
+
+  CongestionControlVegas();
+
+  virtual void
+  Reset(double initialWindow);
+
+protected:
+  virtual void
+  IncreaseWindow(Time rtt);
+
+  virtual void
+  DecreaseWindow();
+
+private:
+  double m_alpha;
+  double m_beta;
+  double m_gamma;
+  double m_decreaseFactor;
+
+  Time m_roundEnd;    ///< @brief end of the current measurement round
+  Time m_roundMinRtt; ///< @brief smallest RTT sample in the current round
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_CONGESTION_CONTROL_H
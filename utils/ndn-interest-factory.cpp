@@ -0,0 +1,227 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "ndn-interest-factory.hpp"
+
+#include <ndn-cxx/encoding/buffer.hpp>
+#include <ndn-cxx/encoding/tlv.hpp>
+
+#include <cstring>
+#include <limits>
+
+namespace ns3 {
+namespace ndn {
+
+static const size_t NONCE_BATCH_SIZE = 64;
+
+static size_t
+getVarNumberSize(uint64_t number)
+{
+  if (number < 253) {
+    return 1;
+  }
+  else if (number <= std::numeric_limits<uint16_t>::max()) {
+    return 3;
+  }
+  else if (number <= std::numeric_limits<uint32_t>::max()) {
+    return 5;
+  }
+  return 9;
+}
+
+static size_t
+getNonNegativeIntegerSize(uint64_t number)
+{
+  if (number <= std::numeric_limits<uint8_t>::max()) {
+    return 1;
+  }
+  else if (number <= std::numeric_limits<uint16_t>::max()) {
+    return 2;
+  }
+  else if (number <= std::numeric_limits<uint32_t>::max()) {
+    return 4;
+  }
+  return 8;
+}
+
+static uint8_t*
+writeBigEndian(uint8_t* out, uint64_t number, size_t size)
+{
+  for (size_t i = size; i > 0; --i) {
+    out[i - 1] = static_cast<uint8_t>(number & 0xFF);
+    number >>= 8;
+  }
+  return out + size;
+}
+
+static uint8_t*
+writeVarNumber(uint8_t* out, uint64_t number)
+{
+  size_t size = getVarNumberSize(number);
+  if (size == 1) {
+    *out = static_cast<uint8_t>(number);
+    return out + 1;
+  }
+
+  *out = (size == 3) ? 253 : ((size == 5) ? 254 : 255);
+  return writeBigEndian(out + 1, number, size - 1);
+}
+
+/**
+ * @brief TLV type and marker of sequence number components, as encoded by ndn-cxx
+ *
+ * Depending on ndn-cxx version and configuration, sequence numbers are either encoded as
+ * generic components with 0xFE marker or as typed components
+ */
+struct SequenceNumberConvention {
+  SequenceNumberConvention()
+  {
+    name::Component probe = name::Component::fromSequenceNumber(1);
+    type = probe.type();
+    hasMarker = probe.value_size() == 2;
+    marker = hasMarker ? probe.value()[0] : 0;
+  }
+
+  uint32_t type;
+  bool hasMarker;
+  uint8_t marker;
+};
+
+InterestFactory::InterestFactory(Ptr<UniformRandomVariable> rand)
+  : m_rand(rand)
+  , m_prefixWireSize(0)
+  , m_lifetime(Seconds(-1))
+{
+}
+
+InterestFactory&
+InterestFactory::start(const Name& prefix)
+{
+  if (prefix != m_prefix) {
+    m_prefix = prefix;
+    const Block& wire = m_prefix.wireEncode();
+    m_buffer.assign(wire.value_begin(), wire.value_end());
+    m_prefixWireSize = m_buffer.size();
+  }
+  else {
+    m_buffer.resize(m_prefixWireSize);
+  }
+  return *this;
+}
+
+void
+InterestFactory::appendVarNumber(uint64_t number)
+{
+  size_t offset = m_buffer.size();
+  m_buffer.resize(offset + getVarNumberSize(number));
+  writeVarNumber(&m_buffer[offset], number);
+}
+
+void
+InterestFactory::appendNonNegativeInteger(uint64_t number)
+{
+  size_t offset = m_buffer.size();
+  size_t size = getNonNegativeIntegerSize(number);
+  m_buffer.resize(offset + size);
+  writeBigEndian(&m_buffer[offset], number, size);
+}
+
+InterestFactory&
+InterestFactory::appendSequenceNumber(uint64_t number)
+{
+  static const SequenceNumberConvention convention;
+
+  appendVarNumber(convention.type);
+  appendVarNumber(getNonNegativeIntegerSize(number) + (convention.hasMarker ? 1 : 0));
+  if (convention.hasMarker) {
+    m_buffer.push_back(convention.marker);
+  }
+  appendNonNegativeInteger(number);
+  return *this;
+}
+
+InterestFactory&
+InterestFactory::append(const name::Component& component)
+{
+  const Block& wire = component.wireEncode();
+  m_buffer.insert(m_buffer.end(), wire.begin(), wire.end());
+  return *this;
+}
+
+const time::milliseconds&
+InterestFactory::getLifetime(Time lifetime)
+{
+  if (lifetime != m_lifetime) {
+    m_lifetime = lifetime;
+    m_lifetimeMs = time::milliseconds(lifetime.GetMilliSeconds());
+  }
+  return m_lifetimeMs;
+}
+
+shared_ptr<Interest>
+InterestFactory::build(Time lifetime)
+{
+  size_t length = m_buffer.size();
+  size_t headerSize = getVarNumberSize(::ndn::tlv::Name) + getVarNumberSize(length);
+
+  auto buffer = make_shared<::ndn::Buffer>(headerSize + length);
+  uint8_t* out = buffer->data();
+  out = writeVarNumber(out, ::ndn::tlv::Name);
+  out = writeVarNumber(out, length);
+  if (length > 0) {
+    std::memcpy(out, m_buffer.data(), length);
+  }
+
+  return build(Name(Block(buffer)), lifetime);
+}
+
+shared_ptr<Interest>
+InterestFactory::build(const Name& name, Time lifetime)
+{
+  shared_ptr<Interest> interest = make_shared<Interest>(name, getLifetime(lifetime));
+  interest->setNonce(getNonce());
+  return interest;
+}
+
+uint32_t
+InterestFactory::getNonce()
+{
+  if (m_nonces.empty()) {
+    // seed a batch from the application's random stream (splitmix64 generator)
+    uint64_t state = m_rand->GetInteger(0, std::numeric_limits<uint32_t>::max());
+    state = (state << 32) | m_rand->GetInteger(0, std::numeric_limits<uint32_t>::max());
+
+    m_nonces.resize(NONCE_BATCH_SIZE);
+    for (uint32_t& nonce : m_nonces) {
+      state += 0x9E3779B97F4A7C15ULL;
+      uint64_t z = state;
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+      nonce = static_cast<uint32_t>((z ^ (z >> 31)) >> 32);
+    }
+  }
+
+  uint32_t nonce = m_nonces.back();
+  m_nonces.pop_back();
+  return nonce;
+}
+
+} // namespace ndn
+} // namespace ns3
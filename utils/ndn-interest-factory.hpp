@@ -0,0 +1,120 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#ifndef NDN_INTEREST_FACTORY_H
+#define NDN_INTEREST_FACTORY_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/ptr.h"
+#include "ns3/random-variable-stream.h"
+
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief Fast construction of Interests that share a name prefix
+ *
+ * Names are encoded directly into TLV wire format: the encoded prefix is cached and reused as
+ * long as consecutive Interests start with the same prefix, and the remaining components are
+ * appended into a pooled buffer.  The resulting Name carries its wire encoding, so it is not
+ * re-encoded when the Interest is sent.  The InterestLifetime value is cached as well, and
+ * nonces are generated in batches seeded from the application's random stream, so that
+ * simulations remain reproducible.
+ *
+ * Example:
+ *
+ *     shared_ptr<Interest> interest = m_interestFactory.start(m_interestName)
+ *                                       .appendSequenceNumber(seq)
+ *                                       .build(m_interestLifeTime);
+ */
+class InterestFactory {
+public:
+  /**
+   * @param rand random stream from which nonces are seeded
+   */
+  explicit InterestFactory(Ptr<UniformRandomVariable> rand);
+
+  /**
+   * @brief Start name of a new Interest from @p prefix
+   */
+  InterestFactory&
+  start(const Name& prefix);
+
+  /**
+   * @brief Append sequence number component to the name being built
+   */
+  InterestFactory&
+  appendSequenceNumber(uint64_t number);
+
+  /**
+   * @brief Append an arbitrary component to the name being built
+   */
+  InterestFactory&
+  append(const name::Component& component);
+
+  /**
+   * @brief Create Interest for the name being built
+   */
+  shared_ptr<Interest>
+  build(Time lifetime);
+
+  /**
+   * @brief Create Interest for an already existing name (e.g., retransmission)
+   */
+  shared_ptr<Interest>
+  build(const Name& name, Time lifetime);
+
+  /**
+   * @brief Get next nonce
+   */
+  uint32_t
+  getNonce();
+
+private:
+  void
+  appendNonNegativeInteger(uint64_t number);
+
+  void
+  appendVarNumber(uint64_t number);
+
+  const time::milliseconds&
+  getLifetime(Time lifetime);
+
+private:
+  Ptr<UniformRandomVariable> m_rand;
+
+  Name m_prefix;                    ///< @brief last used prefix
+  size_t m_prefixWireSize;          ///< @brief size of encoded components of m_prefix
+  std::vector<uint8_t> m_buffer;    ///< @brief encoded components of the name being built
+
+  Time m_lifetime;
+  time::milliseconds m_lifetimeMs;
+
+  std::vector<uint32_t> m_nonces;   ///< @brief pre-generated nonces, used from the back
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_INTEREST_FACTORY_H
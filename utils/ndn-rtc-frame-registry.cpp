@@ -0,0 +1,80 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-rtc-frame-registry.hpp"
+
+#include "ns3/log.h"
+
+NS_LOG_COMPONENT_DEFINE("ndn.RtcFrameRegistry");
+
+namespace ns3 {
+namespace ndn {
+
+RtcFrameRegistry::RtcFrameRegistry(const Name& streamPrefix)
+  : m_namespace(streamPrefix)
+{
+}
+
+shared_ptr<RtcFrameRegistry>
+RtcFrameRegistry::getRegistry(const Name& streamPrefix)
+{
+  static std::map<Name, std::weak_ptr<RtcFrameRegistry>> registries;
+
+  shared_ptr<RtcFrameRegistry> registry = registries[streamPrefix].lock();
+  if (registry == nullptr) {
+    registry = make_shared<RtcFrameRegistry>(streamPrefix);
+    registries[streamPrefix] = registry;
+  }
+  return registry;
+}
+
+const RtcFrameRegistry::FrameInfo*
+RtcFrameRegistry::recordFrame(const Name& frameName, Time generationTime, uint32_t nSegments)
+{
+  RtcName parsed = m_namespace.parse(frameName);
+  if (parsed.type != RTC_FRAME_KEY && parsed.type != RTC_FRAME_DELTA) {
+    NS_LOG_WARN(frameName << " is not a frame name, not recorded");
+    return nullptr;
+  }
+
+  bool isNew = false;
+  std::map<Key, uint64_t>::iterator it;
+  std::tie(it, isNew) = m_index.insert(std::make_pair(makeKey(parsed), m_frames.size()));
+  if (!isNew) {
+    NS_LOG_WARN(frameName << " has already been recorded");
+    return &m_frames[it->second];
+  }
+
+  m_frames.push_back(FrameInfo{m_frames.size(), parsed.type, frameName, generationTime,
+                               nSegments});
+  return &m_frames.back();
+}
+
+const RtcFrameRegistry::FrameInfo*
+RtcFrameRegistry::findFrame(const RtcName& name) const
+{
+  auto it = m_index.find(makeKey(name));
+  if (it == m_index.end()) {
+    return nullptr;
+  }
+  return &m_frames[it->second];
+}
+
+} // namespace ndn
+} // namespace ns3
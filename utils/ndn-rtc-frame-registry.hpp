@@ -0,0 +1,115 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_RTC_FRAME_REGISTRY_H
+#define NDN_RTC_FRAME_REGISTRY_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/utils/ndn-rtc-name.hpp"
+
+#include "ns3/nstime.h"
+
+#include <map>
+#include <tuple>
+#include <deque>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief In-simulation record of the frames generated by one RTC stream
+ *
+ * The producer of the stream records every frame when it is generated; consumers of the
+ * stream look up generation times and segment counts of the frames they receive.  All apps
+ * of the same stream share a single registry, which is released when the last app releases it.
+ */
+class RtcFrameRegistry {
+public:
+  struct FrameInfo {
+    uint64_t seq; ///< @brief position of the frame in the stream, in generation order
+    RtcFrameType type;
+    Name name; ///< @brief frame name, without segment number
+    Time generationTime;
+    uint32_t nSegments;
+  };
+
+  explicit RtcFrameRegistry(const Name& streamPrefix);
+
+  /**
+   * @brief Get (shared) registry of stream @p streamPrefix
+   */
+  static shared_ptr<RtcFrameRegistry>
+  getRegistry(const Name& streamPrefix);
+
+  /**
+   * @brief Record key or delta frame @p frameName (without segment number)
+   * @return recorded frame, or nullptr if @p frameName is not a key or delta frame name
+   */
+  const FrameInfo*
+  recordFrame(const Name& frameName, Time generationTime, uint32_t nSegments);
+
+  /**
+   * @brief Find frame that @p name (a segment of the frame) belongs to
+   * @return the frame, or nullptr if the frame has not been recorded
+   */
+  const FrameInfo*
+  findFrame(const RtcName& name) const;
+
+  /**
+   * @brief Get frame by its position in the stream
+   * @pre @p seq < size()
+   */
+  const FrameInfo&
+  getFrame(uint64_t seq) const
+  {
+    return m_frames[seq];
+  }
+
+  size_t
+  size() const
+  {
+    return m_frames.size();
+  }
+
+  const RtcNamespace&
+  getNamespace() const
+  {
+    return m_namespace;
+  }
+
+private:
+  typedef std::tuple<RtcFrameType, uint64_t, uint64_t> Key;
+
+  static Key
+  makeKey(const RtcName& name)
+  {
+    return Key(name.type, name.keyId, name.deltaId);
+  }
+
+private:
+  RtcNamespace m_namespace;
+  std::deque<FrameInfo> m_frames; ///< @brief deque, so that references stay valid on insertion
+  std::map<Key, uint64_t> m_index;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_RTC_FRAME_REGISTRY_H
@@ -0,0 +1,175 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-rtc-name.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+const uint64_t RtcName::NONE;
+
+const name::Component RtcNamespace::DISCOVERY("discovery");
+const name::Component RtcNamespace::KEY("key");
+const name::Component RtcNamespace::DELTA("delta");
+const name::Component RtcNamespace::PAIRED_KEY("paired-key");
+const name::Component RtcNamespace::FEC("fec");
+const name::Component RtcNamespace::LAYER("layer");
+
+/**
+ * @brief Read sequence number at @p index of @p name into @p number
+ * @return false if there is no such component or it is not a sequence number
+ */
+static bool
+readSequenceNumber(const Name& name, size_t index, uint64_t& number)
+{
+  if (index >= name.size() || !name[index].isSequenceNumber()) {
+    return false;
+  }
+  number = name[index].toSequenceNumber();
+  return true;
+}
+
+/**
+ * @brief Read segment number, /fec/<parity>, or /layer/<layer>/<segment> at @p index of
+ * @p name into @p parsed
+ */
+static void
+readSegment(const Name& name, size_t index, RtcName& parsed)
+{
+  if (readSequenceNumber(name, index, parsed.segment) || index >= name.size()) {
+    return;
+  }
+  if (name[index] == RtcNamespace::FEC) {
+    readSequenceNumber(name, index + 1, parsed.parity);
+  }
+  else if (name[index] == RtcNamespace::LAYER
+           && readSequenceNumber(name, index + 1, parsed.layer)) {
+    readSequenceNumber(name, index + 2, parsed.segment);
+  }
+}
+
+RtcNamespace::RtcNamespace()
+  : RtcNamespace(Name())
+{
+}
+
+RtcNamespace::RtcNamespace(const Name& streamPrefix)
+  : m_streamPrefix(streamPrefix)
+  , m_discoveryName(Name(streamPrefix).append(DISCOVERY))
+  , m_keyPrefix(Name(streamPrefix).append(KEY))
+  , m_deltaPrefix(Name(streamPrefix).append(DELTA))
+{
+  // encode once, so copies of these names share the wire encoding
+  m_streamPrefix.wireEncode();
+  m_discoveryName.wireEncode();
+  m_keyPrefix.wireEncode();
+  m_deltaPrefix.wireEncode();
+}
+
+Name
+RtcNamespace::getKeyFrameName(uint64_t keyId) const
+{
+  return Name(m_keyPrefix).appendSequenceNumber(keyId);
+}
+
+Name
+RtcNamespace::getDeltaFrameName(uint64_t deltaId, uint64_t keyId) const
+{
+  return Name(m_deltaPrefix).appendSequenceNumber(deltaId).append(PAIRED_KEY).appendSequenceNumber(keyId);
+}
+
+Name
+RtcNamespace::getParityName(const Name& frameName, uint64_t parity)
+{
+  return Name(frameName).append(FEC).appendSequenceNumber(parity);
+}
+
+Name
+RtcNamespace::getLayerName(const Name& frameName, uint64_t layer)
+{
+  if (layer == 0) {
+    return frameName;
+  }
+  return Name(frameName).append(LAYER).appendSequenceNumber(layer);
+}
+
+bool
+RtcNamespace::isTypePrefix(const Name& name) const
+{
+  return name.size() == m_streamPrefix.size() + 1 && getFrameType(name) != RTC_FRAME_UNKNOWN
+         && m_streamPrefix.isPrefixOf(name);
+}
+
+RtcFrameType
+RtcNamespace::getFrameType(const name::Component& component)
+{
+  // most frequent first
+  if (component == DELTA) {
+    return RTC_FRAME_DELTA;
+  }
+  if (component == KEY) {
+    return RTC_FRAME_KEY;
+  }
+  if (component == DISCOVERY) {
+    return RTC_FRAME_DISCOVERY;
+  }
+  return RTC_FRAME_UNKNOWN;
+}
+
+RtcFrameType
+RtcNamespace::getFrameType(const Name& name) const
+{
+  if (name.size() <= m_streamPrefix.size()) {
+    return RTC_FRAME_UNKNOWN;
+  }
+  return getFrameType(name[m_streamPrefix.size()]);
+}
+
+RtcName
+RtcNamespace::parse(const Name& name) const
+{
+  RtcName parsed;
+  parsed.type = getFrameType(name);
+
+  size_t i = m_streamPrefix.size() + 1;
+  switch (parsed.type) {
+  case RTC_FRAME_DISCOVERY:
+    if (readSequenceNumber(name, i, parsed.keyId)) {
+      readSequenceNumber(name, i + 1, parsed.deltaId);
+    }
+    break;
+  case RTC_FRAME_KEY:
+    if (readSequenceNumber(name, i, parsed.keyId)) {
+      readSegment(name, i + 1, parsed);
+    }
+    break;
+  case RTC_FRAME_DELTA:
+    if (readSequenceNumber(name, i, parsed.deltaId) && i + 1 < name.size()
+        && name[i + 1] == PAIRED_KEY && readSequenceNumber(name, i + 2, parsed.keyId)) {
+      readSegment(name, i + 3, parsed);
+    }
+    break;
+  default:
+    break;
+  }
+  return parsed;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,234 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_RTC_NAME_H
+#define NDN_RTC_NAME_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <limits>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @brief Type of RTC name, as identified by the component that follows the stream prefix
+ */
+enum RtcFrameType {
+  RTC_FRAME_UNKNOWN = 0,
+  RTC_FRAME_DISCOVERY,
+  RTC_FRAME_KEY,
+  RTC_FRAME_DELTA
+};
+
+/**
+ * @ingroup ndn-apps
+ * @brief RTC name, parsed into its numeric fields
+ *
+ * Fields that are not present in the parsed name are set to RtcName::NONE.
+ */
+struct RtcName {
+  static const uint64_t NONE = std::numeric_limits<uint64_t>::max();
+
+  RtcName()
+    : type(RTC_FRAME_UNKNOWN)
+    , keyId(NONE)
+    , deltaId(NONE)
+    , segment(NONE)
+    , parity(NONE)
+    , layer(NONE)
+  {
+  }
+
+  bool
+  hasSegment() const
+  {
+    return segment != NONE;
+  }
+
+  bool
+  hasParity() const
+  {
+    return parity != NONE;
+  }
+
+  /**
+   * @brief Check whether the name belongs to an SVC enhancement layer (not the base layer)
+   */
+  bool
+  hasLayer() const
+  {
+    return layer != NONE;
+  }
+
+  /**
+   * @brief Check whether the name is the name of a whole key or delta frame (without segment
+   * or parity number), i.e., the name of a bundle of all data segments of the frame
+   */
+  bool
+  isFrame() const
+  {
+    return (type == RTC_FRAME_KEY || (type == RTC_FRAME_DELTA && deltaId != NONE))
+           && keyId != NONE && !hasSegment() && !hasParity() && !hasLayer();
+  }
+
+  /**
+   * @brief Check whether both names refer to (segments of) the same frame
+   */
+  bool
+  isSameFrame(const RtcName& other) const
+  {
+    return type == other.type && keyId == other.keyId && deltaId == other.deltaId;
+  }
+
+  RtcFrameType type;
+  uint64_t keyId;   ///< @brief key frame number (paired key frame number for delta frames)
+  uint64_t deltaId; ///< @brief delta frame number
+  uint64_t segment;
+  uint64_t parity; ///< @brief index of FEC parity segment
+  uint64_t layer;  ///< @brief SVC enhancement layer (1, 2, ...), NONE for the base layer
+};
+
+/**
+ * @ingroup ndn-apps
+ * @brief Naming schema of a single RTC stream (conference prefix followed by producer prefix)
+ *
+ * Names of the stream have the following structure:
+ *
+ *     <stream>/discovery[/<key>/<delta>]
+ *     <stream>/key/<key>[<suffix>]
+ *     <stream>/delta/<delta>/paired-key/<key>[<suffix>]
+ *
+ *     <suffix> ::= /<segment> | /fec/<parity> | /layer/<layer>/<segment>
+ *
+ * where all numbers are sequence number components.  Prefixes of the stream are encoded
+ * once when the namespace is created, and names are parsed by comparing components against
+ * the pre-built constants, without any conversion to URI strings.
+ */
+class RtcNamespace {
+public:
+  static const name::Component DISCOVERY;
+  static const name::Component KEY;
+  static const name::Component DELTA;
+  static const name::Component PAIRED_KEY;
+  static const name::Component FEC;
+  static const name::Component LAYER;
+
+  RtcNamespace();
+
+  explicit RtcNamespace(const Name& streamPrefix);
+
+  const Name&
+  getStreamPrefix() const
+  {
+    return m_streamPrefix;
+  }
+
+  /**
+   * @brief Get <stream>/discovery
+   */
+  const Name&
+  getDiscoveryName() const
+  {
+    return m_discoveryName;
+  }
+
+  /**
+   * @brief Get <stream>/key
+   */
+  const Name&
+  getKeyPrefix() const
+  {
+    return m_keyPrefix;
+  }
+
+  /**
+   * @brief Get <stream>/delta
+   */
+  const Name&
+  getDeltaPrefix() const
+  {
+    return m_deltaPrefix;
+  }
+
+  /**
+   * @brief Get name of key frame @p keyId (without segment number)
+   */
+  Name
+  getKeyFrameName(uint64_t keyId) const;
+
+  /**
+   * @brief Get name of delta frame @p deltaId paired with key frame @p keyId (without segment
+   * number)
+   */
+  Name
+  getDeltaFrameName(uint64_t deltaId, uint64_t keyId) const;
+
+  /**
+   * @brief Get name of FEC parity segment @p parity of frame @p frameName
+   */
+  static Name
+  getParityName(const Name& frameName, uint64_t parity);
+
+  /**
+   * @brief Get prefix of segments of SVC layer @p layer of frame @p frameName
+   *
+   * Segments of the base layer (layer 0) are named directly under the frame name.
+   */
+  static Name
+  getLayerName(const Name& frameName, uint64_t layer);
+
+  /**
+   * @brief Check whether @p name is one of <stream>/discovery, <stream>/key, <stream>/delta
+   */
+  bool
+  isTypePrefix(const Name& name) const;
+
+  /**
+   * @brief Get type of @p name, looking only at the component after the stream prefix
+   *
+   * The stream prefix itself is not verified, as all names that an RTC app sends or receives
+   * belong to its own stream.
+   */
+  RtcFrameType
+  getFrameType(const Name& name) const;
+
+  /**
+   * @brief Parse @p name of the stream
+   *
+   * As in getFrameType(), the stream prefix is not verified.  Parsing stops at the first
+   * component that does not match the schema.
+   */
+  RtcName
+  parse(const Name& name) const;
+
+  static RtcFrameType
+  getFrameType(const name::Component& component);
+
+private:
+  Name m_streamPrefix;
+  Name m_discoveryName;
+  Name m_keyPrefix;
+  Name m_deltaPrefix;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_RTC_NAME_H
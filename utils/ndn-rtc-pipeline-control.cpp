@@ -0,0 +1,270 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-rtc-pipeline-control.hpp"
+
+#include "ns3/simulator.h"
+#include "ns3/double.h"
+#include "ns3/uinteger.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+NS_LOG_COMPONENT_DEFINE("ndn.RtcPipelineControl");
+
+namespace ns3 {
+namespace ndn {
+
+NS_OBJECT_ENSURE_REGISTERED(RtcPipelineControl);
+NS_OBJECT_ENSURE_REGISTERED(RtcPipelineControlEwma);
+NS_OBJECT_ENSURE_REGISTERED(RtcPipelineControlMinDrd);
+NS_OBJECT_ENSURE_REGISTERED(RtcPipelineControlPercentile);
+
+TypeId
+RtcPipelineControl::GetTypeId()
+{
+  static TypeId tid =
+    TypeId("ns3::ndn::RtcPipelineControl")
+      .SetGroupName("Ndn")
+      .SetParent<Object>()
+      .AddAttribute("MinLambda", "Lower bound of the pipeline size (frames)", UintegerValue(1),
+                    MakeUintegerAccessor(&RtcPipelineControl::m_minLambda),
+                    MakeUintegerChecker<uint32_t>(1))
+      .AddAttribute("MaxLambda", "Upper bound of the pipeline size (frames)", UintegerValue(100),
+                    MakeUintegerAccessor(&RtcPipelineControl::m_maxLambda),
+                    MakeUintegerChecker<uint32_t>(1))
+
+      .AddTraceSource("Lambda", "Pipeline size (number of frames requested ahead)",
+                      MakeTraceSourceAccessor(&RtcPipelineControl::m_lambda),
+                      "ns3::TracedValueCallback::Uint32");
+  return tid;
+}
+
+RtcPipelineControl::RtcPipelineControl()
+  : m_minLambda(1)
+  , m_maxLambda(100)
+  , m_lambda(1)
+{
+}
+
+void
+RtcPipelineControl::Reset(Time framePeriod, Time initialDrd)
+{
+  m_framePeriod = framePeriod;
+  m_holdEnd = Time(0);
+  AddSample(initialDrd);
+  UpdateLambda(true);
+}
+
+void
+RtcPipelineControl::OnData(Time drd, bool isFresh, bool isMarked)
+{
+  if (!isFresh) {
+    NS_LOG_DEBUG("DRD sample " << drd.As(Time::MS) << " of stale Data, ignoring");
+    return;
+  }
+
+  AddSample(drd);
+
+  Time now = Simulator::Now();
+  if (isMarked && now >= m_holdEnd) {
+    NS_LOG_DEBUG("Congestion mark, lambda cannot grow until " << (now + GetEstimate()).As(Time::S));
+    m_holdEnd = now + GetEstimate();
+  }
+  UpdateLambda(now >= m_holdEnd);
+}
+
+void
+RtcPipelineControl::OnTimeout()
+{
+  Time now = Simulator::Now();
+  if (now < m_holdEnd) {
+    return;
+  }
+
+  m_holdEnd = now + GetEstimate();
+  m_lambda = std::max(m_minLambda, m_lambda.Get() - 1);
+  NS_LOG_DEBUG("Timeout, lambda decreased to " << m_lambda);
+}
+
+void
+RtcPipelineControl::UpdateLambda(bool canGrow)
+{
+  uint32_t lambda = static_cast<uint32_t>(std::ceil(GetEstimate().GetSeconds()
+                                                    / m_framePeriod.GetSeconds()));
+  lambda = std::min(std::max(lambda, m_minLambda), m_maxLambda);
+  if (lambda > m_lambda && !canGrow) {
+    return;
+  }
+  m_lambda = lambda;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TypeId
+RtcPipelineControlEwma::GetTypeId()
+{
+  static TypeId tid =
+    TypeId("ns3::ndn::RtcPipelineControlEwma")
+      .SetGroupName("Ndn")
+      .SetParent<RtcPipelineControl>()
+      .AddConstructor<RtcPipelineControlEwma>()
+      .AddAttribute("Gain", "Weight of a new DRD sample in the moving average", DoubleValue(0.125),
+                    MakeDoubleAccessor(&RtcPipelineControlEwma::m_gain),
+                    MakeDoubleChecker<double>(0.0, 1.0));
+  return tid;
+}
+
+RtcPipelineControlEwma::RtcPipelineControlEwma()
+  : m_gain(0.125)
+{
+}
+
+void
+RtcPipelineControlEwma::Reset(Time framePeriod, Time initialDrd)
+{
+  m_average = Time(0);
+  RtcPipelineControl::Reset(framePeriod, initialDrd);
+}
+
+void
+RtcPipelineControlEwma::AddSample(Time drd)
+{
+  if (m_average.IsZero()) {
+    m_average = drd;
+    return;
+  }
+  m_average = m_average + Seconds(m_gain * (drd - m_average).GetSeconds());
+}
+
+Time
+RtcPipelineControlEwma::GetEstimate() const
+{
+  return m_average;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TypeId
+RtcPipelineControlMinDrd::GetTypeId()
+{
+  static TypeId tid =
+    TypeId("ns3::ndn::RtcPipelineControlMinDrd")
+      .SetGroupName("Ndn")
+      .SetParent<RtcPipelineControl>()
+      .AddConstructor<RtcPipelineControlMinDrd>()
+      .AddAttribute("Window", "Time window over which the minimum DRD is taken",
+                    TimeValue(Seconds(2)), MakeTimeAccessor(&RtcPipelineControlMinDrd::m_window),
+                    MakeTimeChecker());
+  return tid;
+}
+
+RtcPipelineControlMinDrd::RtcPipelineControlMinDrd()
+  : m_window(Seconds(2))
+{
+}
+
+void
+RtcPipelineControlMinDrd::Reset(Time framePeriod, Time initialDrd)
+{
+  m_samples.clear();
+  RtcPipelineControl::Reset(framePeriod, initialDrd);
+}
+
+void
+RtcPipelineControlMinDrd::AddSample(Time drd)
+{
+  Time now = Simulator::Now();
+
+  // samples that are larger than a newer one can never become the minimum
+  while (!m_samples.empty() && m_samples.back().second >= drd) {
+    m_samples.pop_back();
+  }
+  m_samples.push_back(std::make_pair(now, drd));
+
+  while (m_samples.front().first + m_window < now) {
+    m_samples.pop_front();
+  }
+}
+
+Time
+RtcPipelineControlMinDrd::GetEstimate() const
+{
+  return m_samples.empty() ? Time(0) : m_samples.front().second;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TypeId
+RtcPipelineControlPercentile::GetTypeId()
+{
+  static TypeId tid =
+    TypeId("ns3::ndn::RtcPipelineControlPercentile")
+      .SetGroupName("Ndn")
+      .SetParent<RtcPipelineControl>()
+      .AddConstructor<RtcPipelineControlPercentile>()
+      .AddAttribute("Percentile", "Percentile of DRD samples that lambda covers", DoubleValue(90),
+                    MakeDoubleAccessor(&RtcPipelineControlPercentile::m_percentile),
+                    MakeDoubleChecker<double>(0.0, 100.0))
+      .AddAttribute("HistorySize", "Number of most recent DRD samples", UintegerValue(100),
+                    MakeUintegerAccessor(&RtcPipelineControlPercentile::m_historySize),
+                    MakeUintegerChecker<uint32_t>(1));
+  return tid;
+}
+
+RtcPipelineControlPercentile::RtcPipelineControlPercentile()
+  : m_percentile(90)
+  , m_historySize(100)
+{
+}
+
+void
+RtcPipelineControlPercentile::Reset(Time framePeriod, Time initialDrd)
+{
+  m_samples.clear();
+  RtcPipelineControl::Reset(framePeriod, initialDrd);
+}
+
+void
+RtcPipelineControlPercentile::AddSample(Time drd)
+{
+  m_samples.push_back(drd);
+  if (m_samples.size() > m_historySize) {
+    m_samples.pop_front();
+  }
+}
+
+Time
+RtcPipelineControlPercentile::GetEstimate() const
+{
+  if (m_samples.empty()) {
+    return Time(0);
+  }
+
+  std::vector<Time> samples(m_samples.begin(), m_samples.end());
+  size_t rank = static_cast<size_t>(std::ceil(m_percentile / 100 * samples.size()));
+  auto nth = samples.begin() + std::max<size_t>(rank, 1) - 1;
+  std::nth_element(samples.begin(), nth, samples.end());
+  return *nth;
+}
+
+} // namespace ndn
+} // namespace ns3
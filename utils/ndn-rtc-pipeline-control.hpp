@@ -0,0 +1,203 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_RTC_PIPELINE_CONTROL_H
+#define NDN_RTC_PIPELINE_CONTROL_H
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/traced-value.h"
+
+#include <deque>
+#include <utility>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief Base class of pipeline size (lambda) controllers of RTC consumers
+ *
+ * Lambda is the number of frames that an RTC consumer keeps requested ahead of the producer,
+ * so that Interests are waiting at the producer when frames are generated.  It is computed as
+ * ceil(DRD / frame period), where DRD (data retrieval delay) is estimated by the subclass from
+ * samples of the delay between sending an Interest and receiving its Data.
+ *
+ * Only samples of fresh Data (frames that arrive about one frame period apart) are used:
+ * cached or previously generated frames arrive in bursts with a DRD of the path to the cache,
+ * which tells nothing about how far ahead of the producer the pipeline should be.
+ *
+ * Congestion (a timeout or a congestion mark) prevents lambda from growing for one DRD
+ * estimate.  A timeout additionally decreases lambda by one, at most once per DRD estimate.
+ */
+class RtcPipelineControl : public Object {
+public:
+  static TypeId
+  GetTypeId();
+
+  RtcPipelineControl();
+
+  /**
+   * @brief Reset controller state
+   * @param framePeriod time between two frames of the stream
+   * @param initialDrd DRD of the bootstrap Interest, which sets the initial lambda
+   */
+  virtual void
+  Reset(Time framePeriod, Time initialDrd);
+
+  uint32_t
+  GetLambda() const
+  {
+    return m_lambda;
+  }
+
+  /**
+   * @brief Notify about received frame segment
+   * @param drd delay between sending the Interest and receiving the Data
+   * @param isFresh false if Data was cached or generated long before the Interest arrived
+   * @param isMarked whether Data carries a congestion mark
+   */
+  void
+  OnData(Time drd, bool isFresh, bool isMarked);
+
+  /**
+   * @brief Notify about timeout of a segment Interest
+   */
+  void
+  OnTimeout();
+
+protected:
+  /**
+   * @brief Add DRD sample of fresh Data to the estimator
+   */
+  virtual void
+  AddSample(Time drd) = 0;
+
+  /**
+   * @brief Get current DRD estimate
+   */
+  virtual Time
+  GetEstimate() const = 0;
+
+private:
+  /**
+   * @brief Set lambda from the current DRD estimate
+   * @param canGrow if false, lambda is only allowed to decrease
+   */
+  void
+  UpdateLambda(bool canGrow);
+
+private:
+  uint32_t m_minLambda;
+  uint32_t m_maxLambda;
+
+  Time m_framePeriod;
+  Time m_holdEnd; ///< @brief lambda does not grow until this time
+
+  TracedValue<uint32_t> m_lambda;
+};
+
+/**
+ * @ingroup ndn-apps
+ * @brief Pipeline controller with exponentially weighted moving average of DRD
+ */
+class RtcPipelineControlEwma : public RtcPipelineControl {
+public:
+  static TypeId
+  GetTypeId();
+
+  RtcPipelineControlEwma();
+
+  virtual void
+  Reset(Time framePeriod, Time initialDrd);
+
+protected:
+  virtual void
+  AddSample(Time drd);
+
+  virtual Time
+  GetEstimate() const;
+
+private:
+  double m_gain;
+  Time m_average; ///< @brief zero until the first sample
+};
+
+/**
+ * @ingroup ndn-apps
+ * @brief Pipeline controller with minimum DRD over a sliding time window
+ *
+ * The smallest DRD is the delay of a frame that was generated right after its Interest arrived
+ * at the producer, so the resulting lambda keeps as few Interests as possible waiting at the
+ * producer, at the risk of an Interest arriving slightly after its frame is generated.
+ */
+class RtcPipelineControlMinDrd : public RtcPipelineControl {
+public:
+  static TypeId
+  GetTypeId();
+
+  RtcPipelineControlMinDrd();
+
+  virtual void
+  Reset(Time framePeriod, Time initialDrd);
+
+protected:
+  virtual void
+  AddSample(Time drd);
+
+  virtual Time
+  GetEstimate() const;
+
+private:
+  Time m_window;
+  /// @brief (arrival time, DRD) of samples within the window, DRDs are increasing
+  std::deque<std::pair<Time, Time>> m_samples;
+};
+
+/**
+ * @ingroup ndn-apps
+ * @brief Pipeline controller with percentile of the last HistorySize DRD samples
+ */
+class RtcPipelineControlPercentile : public RtcPipelineControl {
+public:
+  static TypeId
+  GetTypeId();
+
+  RtcPipelineControlPercentile();
+
+  virtual void
+  Reset(Time framePeriod, Time initialDrd);
+
+protected:
+  virtual void
+  AddSample(Time drd);
+
+  virtual Time
+  GetEstimate() const;
+
+private:
+  double m_percentile;
+  uint32_t m_historySize;
+  std::deque<Time> m_samples;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_RTC_PIPELINE_CONTROL_H
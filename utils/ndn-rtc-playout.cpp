@@ -0,0 +1,220 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-rtc-playout.hpp"
+
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+
+#include <algorithm>
+
+NS_LOG_COMPONENT_DEFINE("ndn.RtcPlayout");
+
+namespace ns3 {
+namespace ndn {
+
+NS_OBJECT_ENSURE_REGISTERED(RtcPlayout);
+
+TypeId
+RtcPlayout::GetTypeId()
+{
+  static TypeId tid =
+    TypeId("ns3::ndn::RtcPlayout")
+      .SetGroupName("Ndn")
+      .SetParent<Object>()
+      .AddConstructor<RtcPlayout>()
+      .AddAttribute("PlayoutDelay",
+                    "Buffering delay before playout starts, and after each stall",
+                    TimeValue(MilliSeconds(100)), MakeTimeAccessor(&RtcPlayout::m_playoutDelay),
+                    MakeTimeChecker())
+
+      .AddTraceSource("FrameCompleted",
+                      "All segments of a frame received (frame name, time since generation)",
+                      MakeTraceSourceAccessor(&RtcPlayout::m_frameCompleted),
+                      "ns3::ndn::RtcPlayout::FrameLatencyCallback")
+      .AddTraceSource("FrameDisplayed", "Frame displayed (frame name, capture-to-display latency)",
+                      MakeTraceSourceAccessor(&RtcPlayout::m_frameDisplayed),
+                      "ns3::ndn::RtcPlayout::FrameLatencyCallback")
+      .AddTraceSource("FrameSkipped", "Frame not displayed, as playout skipped to a key frame",
+                      MakeTraceSourceAccessor(&RtcPlayout::m_frameSkipped),
+                      "ns3::ndn::RtcPlayout::FrameCallback")
+      .AddTraceSource("PlayoutStall", "Playout stall ended (duration of the stall)",
+                      MakeTraceSourceAccessor(&RtcPlayout::m_playoutStall),
+                      "ns3::ndn::RtcPlayout::StallCallback");
+  return tid;
+}
+
+RtcPlayout::RtcPlayout()
+  : m_isPlaying(false)
+  , m_nextFrame(0)
+  , m_isStalled(false)
+  , m_nDisplayed(0)
+  , m_nSkipped(0)
+  , m_nStalls(0)
+{
+}
+
+void
+RtcPlayout::Start(shared_ptr<const RtcFrameRegistry> registry, Time framePeriod)
+{
+  m_registry = registry;
+  m_framePeriod = framePeriod;
+}
+
+void
+RtcPlayout::Stop()
+{
+  m_playEvent.Cancel();
+}
+
+bool
+RtcPlayout::OnSegment(const RtcName& name)
+{
+  // a frame is complete (decodable) once its base layer is, enhancement layers only improve
+  // the quality of the displayed frame
+  if (m_registry == nullptr || (!name.hasSegment() && !name.hasParity() && !name.isFrame())
+      || name.hasLayer() || (name.type != RTC_FRAME_KEY && name.type != RTC_FRAME_DELTA)) {
+    return false;
+  }
+
+  const RtcFrameRegistry::FrameInfo* frame = m_registry->findFrame(name);
+  if (frame == nullptr) {
+    NS_LOG_DEBUG("Segment of unknown frame, ignoring");
+    return false;
+  }
+
+  bool hasDisplayStarted = m_nDisplayed + m_nSkipped > 0;
+  if (hasDisplayStarted && frame->seq < m_nextFrame) {
+    NS_LOG_DEBUG("Segment of " << frame->name << " received after playout passed the frame");
+    return false;
+  }
+  if (m_complete.count(frame->seq) > 0) {
+    return false;
+  }
+
+  // a bundle (Data named after the whole frame) carries all data segments at once
+  if (!name.isFrame()) {
+    // parity segments are numbered after the data segments
+    std::set<uint64_t>& segments = m_incomplete[frame->seq];
+    segments.insert(name.hasSegment() ? name.segment : frame->nSegments + name.parity);
+    if (segments.size() < frame->nSegments) {
+      return false;
+    }
+  }
+
+  m_incomplete.erase(frame->seq);
+  m_complete.insert(frame->seq);
+
+  Time latency = Simulator::Now() - frame->generationTime;
+  NS_LOG_DEBUG("Frame " << frame->name << " complete, latency " << latency.As(Time::MS));
+  m_frameCompleted(frame->name, latency);
+
+  if (!m_isPlaying) {
+    m_isPlaying = true;
+    m_nextFrame = frame->seq;
+    m_playEvent = Simulator::Schedule(m_playoutDelay, &RtcPlayout::PlayNextFrame, this);
+  }
+  else if (!hasDisplayStarted) {
+    // frames may complete out of order while the initial buffer fills up
+    m_nextFrame = std::min(m_nextFrame, frame->seq);
+  }
+  else if (m_isStalled && !m_playEvent.IsRunning()
+           && (frame->seq == m_nextFrame || frame->type == RTC_FRAME_KEY)) {
+    m_playEvent = Simulator::Schedule(m_playoutDelay, &RtcPlayout::PlayNextFrame, this);
+  }
+  return true;
+}
+
+Time
+RtcPlayout::GetPlayoutDeadline(const RtcName& name) const
+{
+  const RtcFrameRegistry::FrameInfo* frame =
+    m_registry != nullptr ? m_registry->findFrame(name) : nullptr;
+  if (frame == nullptr) {
+    return Time::Max();
+  }
+
+  bool hasDisplayStarted = m_nDisplayed + m_nSkipped > 0;
+  if (hasDisplayStarted && frame->seq < m_nextFrame) {
+    return Time(0);
+  }
+  if (!m_playEvent.IsRunning() || frame->seq < m_nextFrame) {
+    return Time::Max();
+  }
+
+  Time nextDisplay = Simulator::Now() + Simulator::GetDelayLeft(m_playEvent);
+  return nextDisplay
+         + TimeStep(m_framePeriod.GetTimeStep() * static_cast<int64_t>(frame->seq - m_nextFrame));
+}
+
+void
+RtcPlayout::PlayNextFrame()
+{
+  Time now = Simulator::Now();
+
+  if (m_complete.count(m_nextFrame) == 0) {
+    uint64_t keyFrame = FindNextCompleteKeyFrame();
+    if (keyFrame == RtcName::NONE) {
+      if (!m_isStalled) {
+        NS_LOG_DEBUG("Next frame is not complete, playout stalled");
+        m_isStalled = true;
+        m_stallStart = now;
+        ++m_nStalls;
+      }
+      return;
+    }
+
+    for (; m_nextFrame < keyFrame; ++m_nextFrame) {
+      m_incomplete.erase(m_nextFrame);
+      m_complete.erase(m_nextFrame);
+      ++m_nSkipped;
+      m_frameSkipped(m_registry->getFrame(m_nextFrame).name);
+    }
+  }
+
+  if (m_isStalled) {
+    Time duration = now - m_stallStart;
+    NS_LOG_DEBUG("Playout resumed after " << duration.As(Time::MS));
+    m_isStalled = false;
+    m_totalStallTime += duration;
+    m_playoutStall(duration);
+  }
+
+  const RtcFrameRegistry::FrameInfo& frame = m_registry->getFrame(m_nextFrame);
+  m_complete.erase(m_nextFrame);
+  ++m_nextFrame;
+  ++m_nDisplayed;
+  m_frameDisplayed(frame.name, now - frame.generationTime);
+
+  m_playEvent = Simulator::Schedule(m_framePeriod, &RtcPlayout::PlayNextFrame, this);
+}
+
+uint64_t
+RtcPlayout::FindNextCompleteKeyFrame() const
+{
+  for (auto it = m_complete.upper_bound(m_nextFrame); it != m_complete.end(); ++it) {
+    if (m_registry->getFrame(*it).type == RTC_FRAME_KEY) {
+      return *it;
+    }
+  }
+  return RtcName::NONE;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,166 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_RTC_PLAYOUT_H
+#define NDN_RTC_PLAYOUT_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/utils/ndn-rtc-frame-registry.hpp"
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/traced-callback.h"
+
+#include <map>
+#include <set>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief Frame assembly and playout buffer model of an RTC consumer
+ *
+ * The consumer reports every received segment.  A frame is complete when as many distinct
+ * segments as the frame has data segments (recorded by the producer in RtcFrameRegistry) have
+ * been received, counting both data and FEC parity segments.
+ *
+ * Playout starts PlayoutDelay after the first frame is complete.  Frames are then displayed
+ * in generation order, one per frame period.  If the next frame is not complete when it is
+ * due, playout stalls until either that frame or a later key frame is complete; in the
+ * latter case, the frames before the key frame cannot be decoded and are skipped.  After a
+ * stall, playout resumes PlayoutDelay after the frame becomes available (rebuffering).
+ * Frames completed after playout has passed them are not displayed.
+ *
+ * The first displayed frame is not required to be a key frame, as RTC consumers join the
+ * stream at its latest (usually delta) frame.
+ */
+class RtcPlayout : public Object {
+public:
+  static TypeId
+  GetTypeId();
+
+  RtcPlayout();
+
+  /**
+   * @brief Start assembling frames of the stream recorded in @p registry
+   * @param framePeriod time between displaying two subsequent frames
+   */
+  void
+  Start(shared_ptr<const RtcFrameRegistry> registry, Time framePeriod);
+
+  void
+  Stop();
+
+  /**
+   * @brief Notify about received (data or parity) segment @p name
+   *
+   * If @p name is the name of a whole frame (a bundle of all its segments), the frame is
+   * complete.  Names that are not segments of recorded key or delta frames, as well as
+   * segments of SVC enhancement layers, are ignored.
+   *
+   * @return true if the segment completed its frame
+   */
+  bool
+  OnSegment(const RtcName& name);
+
+  /**
+   * @brief Get the time when the frame of segment @p name is due for display
+   * @return Time::Max() if the time is not known (the frame has not been generated, playout
+   *         has not started or is stalled), or zero if playout has already passed the frame
+   */
+  Time
+  GetPlayoutDeadline(const RtcName& name) const;
+
+  uint64_t
+  GetNDisplayedFrames() const
+  {
+    return m_nDisplayed;
+  }
+
+  uint64_t
+  GetNSkippedFrames() const
+  {
+    return m_nSkipped;
+  }
+
+  uint64_t
+  GetNStalls() const
+  {
+    return m_nStalls;
+  }
+
+  /**
+   * @brief Total duration of all finished stalls
+   */
+  Time
+  GetTotalStallTime() const
+  {
+    return m_totalStallTime;
+  }
+
+  typedef void (*FrameLatencyCallback)(const Name& frame, Time latency);
+  typedef void (*FrameCallback)(const Name& frame);
+  typedef void (*StallCallback)(Time duration);
+
+private:
+  /**
+   * @brief Display next frame, skip to a key frame, or stall
+   */
+  void
+  PlayNextFrame();
+
+  /**
+   * @brief Find the earliest complete key frame after the next frame to display
+   * @return seq of the key frame, or RtcName::NONE
+   */
+  uint64_t
+  FindNextCompleteKeyFrame() const;
+
+private:
+  Time m_playoutDelay;
+
+  shared_ptr<const RtcFrameRegistry> m_registry;
+  Time m_framePeriod;
+
+  std::map<uint64_t, std::set<uint64_t>> m_incomplete; ///< @brief frame seq => received segments
+  std::set<uint64_t> m_complete; ///< @brief complete frames that are not displayed yet
+
+  bool m_isPlaying;
+  uint64_t m_nextFrame; ///< @brief seq of the next frame to display
+  bool m_isStalled;
+  Time m_stallStart;
+  EventId m_playEvent;
+
+  uint64_t m_nDisplayed;
+  uint64_t m_nSkipped;
+  uint64_t m_nStalls;
+  Time m_totalStallTime;
+
+  TracedCallback<const Name&, Time> m_frameCompleted;
+  TracedCallback<const Name&, Time> m_frameDisplayed;
+  TracedCallback<const Name&> m_frameSkipped;
+  TracedCallback<Time> m_playoutStall;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_RTC_PLAYOUT_H
@@ -30,6 +30,8 @@
 
 #include "ndn-rtt-estimator.hpp"
 
+#include <unordered_map>
+
 namespace ns3 {
 namespace ndn {
 
@@ -43,6 +45,11 @@ namespace ndn {
  * by Van Jacobson and Michael J. Karels, in
  * "Congestion Avoidance and Control", SIGCOMM 88, Appendix A
  *
+ * Unlike the base class, acknowledgements are not assumed to be cumulative: NDN Data packets
+ * may arrive in any order, and each one acknowledges exactly one sequence number.  Send times
+ * are kept in a hash table keyed by sequence number, so both SentSeq and AckSeq are O(1)
+ * regardless of reordering.  Following Karn's rule, no sample is taken for a sequence number
+ * that has been retransmitted.
  */
 class RttMeanDeviation : public RttEstimator {
 public:
@@ -60,6 +67,8 @@ public:
   Time
   AckSeq(SequenceNumber32 ackSeq);
   void
+  ClearSent();
+  void
   Measurement(Time measure);
   Time
   RetransmitTimeout();
@@ -74,6 +83,8 @@ private:
   double m_gain;   // Filter gain
   double m_gain2;  // Filter gain
   Time m_variance; // Current variance
+
+  std::unordered_map<uint32_t, RttHistory> m_sent; // Outstanding sequence numbers
 };
 
 } // namespace ndn
@@ -0,0 +1,291 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "ndn-seq-state-table.hpp"
+
+#include "ns3/assert.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace ns3 {
+namespace ndn {
+
+const uint32_t SeqStateTable::INVALID;
+
+static const size_t INITIAL_N_SLOTS = 16; // must be a power of 2
+
+static inline size_t
+hashSeq(uint32_t seq, size_t mask)
+{
+  // multiplication by an odd constant is a bijection on the low bits, so consecutive
+  // sequence numbers never collide
+  return (seq * 2654435761u) & mask;
+}
+
+SeqStateTable::SeqStateTable()
+  : m_slots(INITIAL_N_SLOTS, INVALID)
+  , m_size(0)
+  , m_head(INVALID)
+  , m_tail(INVALID)
+  , m_nPendingTimeouts(0)
+  , m_nPendingRetx(0)
+{
+}
+
+size_t
+SeqStateTable::findSlot(uint32_t seq) const
+{
+  size_t mask = m_slots.size() - 1;
+  size_t i = hashSeq(seq, mask);
+  while (m_slots[i] != INVALID && m_entries[m_slots[i]].seq != seq) {
+    i = (i + 1) & mask;
+  }
+  return i;
+}
+
+SeqStateTable::Entry*
+SeqStateTable::find(uint32_t seq)
+{
+  uint32_t index = m_slots[findSlot(seq)];
+  if (index == INVALID) {
+    return nullptr;
+  }
+  return &m_entries[index];
+}
+
+uint32_t
+SeqStateTable::allocate(uint32_t seq)
+{
+  uint32_t index;
+  if (!m_free.empty()) {
+    index = m_free.back();
+    m_free.pop_back();
+  }
+  else {
+    index = m_entries.size();
+    m_entries.emplace_back();
+  }
+
+  Entry& entry = m_entries[index];
+  entry.seq = seq;
+  entry.retxCount = 0;
+  entry.isPendingTimeout = false;
+  entry.isPendingRetx = false;
+  entry.prev = INVALID;
+  entry.next = INVALID;
+  return index;
+}
+
+void
+SeqStateTable::grow()
+{
+  std::vector<uint32_t> oldSlots(m_slots.size() * 2, INVALID);
+  oldSlots.swap(m_slots);
+
+  size_t mask = m_slots.size() - 1;
+  for (uint32_t index : oldSlots) {
+    if (index == INVALID) {
+      continue;
+    }
+    size_t i = hashSeq(m_entries[index].seq, mask);
+    while (m_slots[i] != INVALID) {
+      i = (i + 1) & mask;
+    }
+    m_slots[i] = index;
+  }
+}
+
+SeqStateTable::Entry&
+SeqStateTable::onSent(uint32_t seq, Time now)
+{
+  size_t i = findSlot(seq);
+  uint32_t index = m_slots[i];
+  if (index == INVALID) {
+    // keep load factor at or below 1/2
+    if ((m_size + 1) * 2 > m_slots.size()) {
+      grow();
+      i = findSlot(seq);
+    }
+    index = allocate(seq);
+    m_slots[i] = index;
+    m_size++;
+
+    m_entries[index].firstSent = now;
+  }
+
+  Entry& entry = m_entries[index];
+  entry.lastSent = now;
+  entry.retxCount++;
+
+  if (!entry.isPendingTimeout) {
+    NS_ASSERT(m_tail == INVALID || m_entries[m_tail].timeoutStart <= now);
+
+    entry.timeoutStart = now;
+    entry.isPendingTimeout = true;
+    entry.prev = m_tail;
+    entry.next = INVALID;
+    if (m_tail != INVALID) {
+      m_entries[m_tail].next = index;
+    }
+    else {
+      m_head = index;
+    }
+    m_tail = index;
+    m_nPendingTimeouts++;
+  }
+
+  return entry;
+}
+
+void
+SeqStateTable::unlinkTimeout(Entry& entry)
+{
+  if (entry.prev != INVALID) {
+    m_entries[entry.prev].next = entry.next;
+  }
+  else {
+    m_head = entry.next;
+  }
+
+  if (entry.next != INVALID) {
+    m_entries[entry.next].prev = entry.prev;
+  }
+  else {
+    m_tail = entry.prev;
+  }
+
+  entry.prev = INVALID;
+  entry.next = INVALID;
+  entry.isPendingTimeout = false;
+  m_nPendingTimeouts--;
+}
+
+void
+SeqStateTable::erase(uint32_t seq)
+{
+  size_t i = findSlot(seq);
+  uint32_t index = m_slots[i];
+  if (index == INVALID) {
+    return;
+  }
+
+  Entry& entry = m_entries[index];
+  if (entry.isPendingTimeout) {
+    unlinkTimeout(entry);
+  }
+  if (entry.isPendingRetx) {
+    entry.isPendingRetx = false;
+    m_nPendingRetx--;
+    if (m_nPendingRetx == 0) {
+      m_retxHeap.clear(); // drop stale elements
+    }
+  }
+  m_free.push_back(index);
+  m_size--;
+
+  // backward-shift deletion: move up records that would not be found past the emptied slot
+  size_t mask = m_slots.size() - 1;
+  size_t j = i;
+  while (true) {
+    j = (j + 1) & mask;
+    if (m_slots[j] == INVALID) {
+      break;
+    }
+
+    size_t k = hashSeq(m_entries[m_slots[j]].seq, mask);
+    bool isReachable = (i <= j) ? (i < k && k <= j) : (i < k || k <= j);
+    if (isReachable) {
+      continue;
+    }
+
+    m_slots[i] = m_slots[j];
+    i = j;
+  }
+  m_slots[i] = INVALID;
+}
+
+void
+SeqStateTable::clear()
+{
+  std::fill(m_slots.begin(), m_slots.end(), INVALID);
+  m_entries.clear();
+  m_free.clear();
+  m_size = 0;
+
+  m_head = INVALID;
+  m_tail = INVALID;
+  m_nPendingTimeouts = 0;
+
+  m_retxHeap.clear();
+  m_nPendingRetx = 0;
+}
+
+uint32_t
+SeqStateTable::popEarliestTimeout()
+{
+  NS_ASSERT(hasPendingTimeouts());
+
+  Entry& entry = m_entries[m_head];
+  unlinkTimeout(entry);
+  return entry.seq;
+}
+
+void
+SeqStateTable::scheduleRetx(uint32_t seq)
+{
+  Entry* entry = find(seq);
+  if (entry == nullptr || entry->isPendingRetx) {
+    return;
+  }
+
+  entry->isPendingRetx = true;
+  m_nPendingRetx++;
+
+  m_retxHeap.push_back(seq);
+  std::push_heap(m_retxHeap.begin(), m_retxHeap.end(), std::greater<uint32_t>());
+}
+
+uint32_t
+SeqStateTable::popRetx()
+{
+  NS_ASSERT(hasPendingRetx());
+
+  while (true) {
+    NS_ASSERT(!m_retxHeap.empty());
+    std::pop_heap(m_retxHeap.begin(), m_retxHeap.end(), std::greater<uint32_t>());
+    uint32_t seq = m_retxHeap.back();
+    m_retxHeap.pop_back();
+
+    Entry* entry = find(seq);
+    if (entry != nullptr && entry->isPendingRetx) {
+      entry->isPendingRetx = false;
+      m_nPendingRetx--;
+      if (m_nPendingRetx == 0) {
+        m_retxHeap.clear(); // drop stale elements
+      }
+      return seq;
+    }
+    // otherwise, stale element (Data has been received since)
+  }
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,199 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#ifndef NDN_SEQ_STATE_TABLE_H
+#define NDN_SEQ_STATE_TABLE_H
+
+#include "ns3/nstime.h"
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief Per-sequence-number state of outstanding Interests of a consumer
+ *
+ * All state of one sequence number is kept in a single record.  Records are allocated from a
+ * slab (vector with a free list) and indexed by an open-addressed hash table (linear probing,
+ * backward-shift deletion), so sending an Interest or receiving Data costs one lookup and no
+ * heap allocation in the steady state.
+ *
+ * Records pending retransmission timeout are additionally linked into an intrusive list
+ * ordered by the time the Interest was (re)sent.  As Interests are always sent at the current
+ * simulation time, appending to the tail keeps the list ordered, and the earliest deadline is
+ * always at the head.
+ *
+ * Sequence numbers scheduled for retransmission are kept in a binary min-heap (the smallest
+ * sequence number is retransmitted first).  Removal from the heap is lazy: a heap element is
+ * valid only while its record is still marked as scheduled for retransmission.
+ */
+class SeqStateTable {
+public:
+  struct Entry {
+    uint32_t seq;
+    Time firstSent;     ///< @brief time when the first Interest was sent
+    Time lastSent;      ///< @brief time when the last (re)transmitted Interest was sent
+    Time timeoutStart;  ///< @brief time from which retransmission timeout is counted
+    uint32_t retxCount; ///< @brief number of sent Interests (including the first one)
+
+    /// @cond include_hidden
+    bool isPendingTimeout;
+    bool isPendingRetx;
+    uint32_t prev;
+    uint32_t next;
+    /// @endcond
+  };
+
+  SeqStateTable();
+
+  /**
+   * @brief Record that an Interest for @p seq is sent at @p now
+   *
+   * Creates the record if needed, updates the last send time and the Interest count, and
+   * starts the retransmission timeout if it is not already pending.
+   */
+  Entry&
+  onSent(uint32_t seq, Time now);
+
+  /**
+   * @brief Find a record of @p seq
+   * @return pointer to the record or nullptr, if there is none
+   */
+  Entry*
+  find(uint32_t seq);
+
+  /**
+   * @brief Remove all state of @p seq (timeout and retransmission included)
+   */
+  void
+  erase(uint32_t seq);
+
+  /**
+   * @brief Remove all records
+   */
+  void
+  clear();
+
+  /**
+   * @brief Number of records
+   */
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+  /**
+   * @brief Check whether any sequence number has a pending retransmission timeout
+   */
+  bool
+  hasPendingTimeouts() const
+  {
+    return m_head != INVALID;
+  }
+
+  /**
+   * @brief Number of sequence numbers with pending retransmission timeout
+   */
+  size_t
+  getNPendingTimeouts() const
+  {
+    return m_nPendingTimeouts;
+  }
+
+  /**
+   * @brief Record with the earliest retransmission timeout
+   * @pre hasPendingTimeouts()
+   */
+  const Entry&
+  getEarliestTimeout() const
+  {
+    return m_entries[m_head];
+  }
+
+  /**
+   * @brief Stop retransmission timeout of the record with the earliest timeout
+   * @return sequence number of the record
+   * @pre hasPendingTimeouts()
+   */
+  uint32_t
+  popEarliestTimeout();
+
+  /**
+   * @brief Schedule @p seq for retransmission
+   *
+   * Has no effect if there is no record for @p seq or it is already scheduled.
+   */
+  void
+  scheduleRetx(uint32_t seq);
+
+  /**
+   * @brief Check whether any sequence number is scheduled for retransmission
+   */
+  bool
+  hasPendingRetx() const
+  {
+    return m_nPendingRetx != 0;
+  }
+
+  /**
+   * @brief Remove and return the smallest sequence number scheduled for retransmission
+   * @pre hasPendingRetx()
+   */
+  uint32_t
+  popRetx();
+
+private:
+  size_t
+  findSlot(uint32_t seq) const;
+
+  uint32_t
+  allocate(uint32_t seq);
+
+  void
+  grow();
+
+  void
+  unlinkTimeout(Entry& entry);
+
+private:
+  static const uint32_t INVALID = std::numeric_limits<uint32_t>::max();
+
+  std::vector<Entry> m_entries;   ///< @brief slab of records
+  std::vector<uint32_t> m_free;   ///< @brief indexes of free records in the slab
+  std::vector<uint32_t> m_slots;  ///< @brief open-addressed table of record indexes
+  size_t m_size;
+
+  uint32_t m_head; ///< @brief record with the earliest retransmission timeout
+  uint32_t m_tail; ///< @brief record with the latest retransmission timeout
+  size_t m_nPendingTimeouts;
+
+  std::vector<uint32_t> m_retxHeap; ///< @brief min-heap of sequence numbers, may be stale
+  size_t m_nPendingRetx;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_SEQ_STATE_TABLE_H
@@ -33,6 +33,7 @@
 #include <boost/make_shared.hpp>
 
 #include <fstream>
+#include <algorithm>
 
 NS_LOG_COMPONENT_DEFINE("ndn.AppDelayTracer");
 
@@ -45,6 +46,7 @@ static std::list<std::tuple<shared_ptr<std::ostream>, std::list<Ptr<AppDelayTrac
 void
 AppDelayTracer::Destroy()
 {
+  FinalizeAllSummaries();
   g_tracers.clear();
 }
 
@@ -167,6 +169,74 @@ AppDelayTracer::Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream)
   return trace;
 }
 
+void
+AppDelayTracer::InstallAggregatedAll(const std::string& file, Time summaryPeriod/* = Seconds(0)*/,
+                                     bool isPerApp/* = true*/)
+{
+  NodeContainer nodes;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    nodes.Add(*node);
+  }
+
+  InstallAggregated(nodes, file, summaryPeriod, isPerApp);
+}
+
+void
+AppDelayTracer::InstallAggregated(const NodeContainer& nodes, const std::string& file,
+                                  Time summaryPeriod/* = Seconds(0)*/, bool isPerApp/* = true*/)
+{
+  shared_ptr<std::ostream> outputStream;
+  if (file != "-") {
+    shared_ptr<std::ofstream> os(new std::ofstream());
+    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+
+    if (!os->is_open()) {
+      NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+      return;
+    }
+
+    outputStream = os;
+  }
+  else {
+    outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
+  }
+
+  InstallAggregated(nodes, outputStream, summaryPeriod, isPerApp);
+}
+
+void
+AppDelayTracer::InstallAggregated(const NodeContainer& nodes,
+                                  shared_ptr<std::ostream> outputStream,
+                                  Time summaryPeriod, bool isPerApp)
+{
+  std::list<Ptr<AppDelayTracer>> tracers;
+  for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
+    Ptr<AppDelayTracer> trace = Install(*node, outputStream);
+    trace->EnableAggregation(summaryPeriod, isPerApp);
+    tracers.push_back(trace);
+  }
+
+  if (tracers.size() > 0) {
+    tracers.front()->PrintSummaryHeader(*outputStream);
+    *outputStream << "\n";
+  }
+
+  g_tracers.push_back(std::make_tuple(outputStream, tracers));
+
+  // write end-of-run summaries, unless Destroy() is called before
+  Simulator::ScheduleDestroy(&AppDelayTracer::FinalizeAllSummaries);
+}
+
+void
+AppDelayTracer::FinalizeAllSummaries()
+{
+  for (auto& group : g_tracers) {
+    for (auto& tracer : std::get<1>(group)) {
+      tracer->FinalizeSummary();
+    }
+  }
+}
+
 //////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -174,6 +244,9 @@ AppDelayTracer::Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream)
 AppDelayTracer::AppDelayTracer(shared_ptr<std::ostream> os, Ptr<Node> node)
   : m_nodePtr(node)
   , m_os(os)
+  , m_isAggregated(false)
+  , m_isPerApp(true)
+  , m_isFinalized(false)
 {
   m_node = boost::lexical_cast<std::string>(m_nodePtr->GetId());
 
@@ -188,11 +261,48 @@ AppDelayTracer::AppDelayTracer(shared_ptr<std::ostream> os, Ptr<Node> node)
 AppDelayTracer::AppDelayTracer(shared_ptr<std::ostream> os, const std::string& node)
   : m_node(node)
   , m_os(os)
+  , m_isAggregated(false)
+  , m_isPerApp(true)
+  , m_isFinalized(false)
 {
   Connect();
 }
 
-AppDelayTracer::~AppDelayTracer(){};
+AppDelayTracer::~AppDelayTracer()
+{
+  m_summaryEvent.Cancel();
+}
+
+void
+AppDelayTracer::EnableAggregation(Time summaryPeriod, bool isPerApp)
+{
+  m_isAggregated = true;
+  m_isPerApp = isPerApp;
+  m_summaryPeriod = summaryPeriod;
+
+  if (!m_summaryPeriod.IsZero()) {
+    m_summaryEvent = Simulator::Schedule(m_summaryPeriod, &AppDelayTracer::PeriodicSummary, this);
+  }
+}
+
+void
+AppDelayTracer::PeriodicSummary()
+{
+  PrintSummary();
+  m_summaryEvent = Simulator::Schedule(m_summaryPeriod, &AppDelayTracer::PeriodicSummary, this);
+}
+
+void
+AppDelayTracer::FinalizeSummary()
+{
+  if (!m_isAggregated || m_isFinalized) {
+    return;
+  }
+
+  m_summaryEvent.Cancel();
+  PrintSummary();
+  m_isFinalized = true;
+}
 
 void
 AppDelayTracer::Connect()
@@ -230,10 +340,88 @@ AppDelayTracer::PrintHeader(std::ostream& os) const
      << "";
 }
 
+void
+AppDelayTracer::PrintSummaryHeader(std::ostream& os) const
+{
+  os << "Time"
+     << "\t"
+     << "Node"
+     << "\t"
+     << "AppId"
+     << "\t"
+     << "Type"
+     << "\t"
+     << "Metric"
+     << "\t"
+     << "Count"
+     << "\t"
+     << "Min"
+     << "\t"
+     << "Mean"
+     << "\t"
+     << "P50"
+     << "\t"
+     << "P90"
+     << "\t"
+     << "P95"
+     << "\t"
+     << "P99"
+     << "\t"
+     << "P99.9"
+     << "\t"
+     << "Max"
+     << "";
+}
+
+static void
+PrintHistogram(std::ostream& os, double time, const std::string& node, const std::string& appId,
+               const char* type, const char* metric, const LogHistogram& histogram)
+{
+  if (histogram.getCount() == 0) {
+    return;
+  }
+
+  os << time << "\t" << node << "\t" << appId << "\t" << type << "\t" << metric << "\t"
+     << histogram.getCount() << "\t" << histogram.getMin() << "\t" << histogram.getMean() << "\t"
+     << histogram.getValueAtPercentile(50) << "\t" << histogram.getValueAtPercentile(90) << "\t"
+     << histogram.getValueAtPercentile(95) << "\t" << histogram.getValueAtPercentile(99) << "\t"
+     << histogram.getValueAtPercentile(99.9) << "\t" << histogram.getMax() << "\n";
+}
+
+void
+AppDelayTracer::PrintSummary()
+{
+  double time = Simulator::Now().ToDouble(Time::S);
+
+  for (auto& i : m_histograms) {
+    std::string appId = i.first < 0 ? "all" : boost::lexical_cast<std::string>(i.first);
+    Histograms& h = i.second;
+
+    PrintHistogram(*m_os, time, m_node, appId, "LastDelay", "DelayUS", h.lastDelay);
+    PrintHistogram(*m_os, time, m_node, appId, "LastDelay", "HopCount", h.lastHopCount);
+    PrintHistogram(*m_os, time, m_node, appId, "FullDelay", "DelayUS", h.fullDelay);
+    PrintHistogram(*m_os, time, m_node, appId, "FullDelay", "RetxCount", h.fullRetxCount);
+    PrintHistogram(*m_os, time, m_node, appId, "FullDelay", "HopCount", h.fullHopCount);
+
+    h.lastDelay.reset();
+    h.lastHopCount.reset();
+    h.fullDelay.reset();
+    h.fullRetxCount.reset();
+    h.fullHopCount.reset();
+  }
+}
+
 void
 AppDelayTracer::LastRetransmittedInterestDataDelay(Ptr<App> app, uint32_t seqno, Time delay,
                                                    int32_t hopCount)
 {
+  if (m_isAggregated) {
+    Histograms& h = m_histograms[m_isPerApp ? app->GetId() : -1];
+    h.lastDelay.record(std::max<int64_t>(0, delay.GetMicroSeconds()));
+    h.lastHopCount.record(std::max<int32_t>(0, hopCount));
+    return;
+  }
+
   *m_os << Simulator::Now().ToDouble(Time::S) << "\t" << m_node << "\t" << app->GetId() << "\t"
         << seqno << "\t"
         << "LastDelay"
@@ -245,6 +433,14 @@ void
 AppDelayTracer::FirstInterestDataDelay(Ptr<App> app, uint32_t seqno, Time delay, uint32_t retxCount,
                                        int32_t hopCount)
 {
+  if (m_isAggregated) {
+    Histograms& h = m_histograms[m_isPerApp ? app->GetId() : -1];
+    h.fullDelay.record(std::max<int64_t>(0, delay.GetMicroSeconds()));
+    h.fullRetxCount.record(retxCount);
+    h.fullHopCount.record(std::max<int32_t>(0, hopCount));
+    return;
+  }
+
   *m_os << Simulator::Now().ToDouble(Time::S) << "\t" << m_node << "\t" << app->GetId() << "\t"
         << seqno << "\t"
         << "FullDelay"
@@ -28,8 +28,11 @@
 #include <ns3/event-id.h>
 #include <ns3/node-container.h>
 
+#include "ndn-log-histogram.hpp"
+
 #include <tuple>
 #include <list>
+#include <map>
 
 namespace ns3 {
 
@@ -91,6 +94,32 @@ public:
   static Ptr<AppDelayTracer>
   Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream);
 
+  /**
+   * @brief Helper method to install aggregating tracers on all simulation nodes
+   *
+   * Instead of writing one line per received Data packet, aggregating tracers keep log-bucketed
+   * histograms (see LogHistogram) of delays, retransmission counts, and hop counts and write only
+   * percentile summaries (see PrintSummaryHeader for the columns).
+   *
+   * @param file File to which summaries will be written.  If filename is -, then std::out is used
+   * @param summaryPeriod How often summaries of the samples collected since the previous summary
+   *        are written.  If zero, only one summary is written at the end of the simulation
+   *        (on Destroy or Simulator::Destroy, whichever comes first)
+   * @param isPerApp Keep separate histograms for each application (otherwise, per node)
+   */
+  static void
+  InstallAggregatedAll(const std::string& file, Time summaryPeriod = Seconds(0),
+                       bool isPerApp = true);
+
+  /**
+   * @brief Helper method to install aggregating tracers on the selected simulation nodes
+   *
+   * @see InstallAggregatedAll
+   */
+  static void
+  InstallAggregated(const NodeContainer& nodes, const std::string& file,
+                    Time summaryPeriod = Seconds(0), bool isPerApp = true);
+
   /**
    * @brief Explicit request to remove all statically created tracers
    *
@@ -127,10 +156,40 @@ public:
   void
   PrintHeader(std::ostream& os) const;
 
+  /**
+   * @brief Print head of the aggregated trace
+   *
+   * @param os reference to output stream
+   */
+  void
+  PrintSummaryHeader(std::ostream& os) const;
+
 private:
   void
   Connect();
 
+  void
+  EnableAggregation(Time summaryPeriod, bool isPerApp);
+
+  void
+  PeriodicSummary();
+
+  void
+  PrintSummary();
+
+  /**
+   * @brief Write the last summary and stop aggregation
+   */
+  void
+  FinalizeSummary();
+
+  static void
+  FinalizeAllSummaries();
+
+  static void
+  InstallAggregated(const NodeContainer& nodes, shared_ptr<std::ostream> outputStream,
+                    Time summaryPeriod, bool isPerApp);
+
   void
   LastRetransmittedInterestDataDelay(Ptr<App> app, uint32_t seqno, Time delay, int32_t hopCount);
 
@@ -143,6 +202,21 @@ private:
   Ptr<Node> m_nodePtr;
 
   shared_ptr<std::ostream> m_os;
+
+  struct Histograms {
+    LogHistogram lastDelay;
+    LogHistogram lastHopCount;
+    LogHistogram fullDelay;
+    LogHistogram fullRetxCount;
+    LogHistogram fullHopCount;
+  };
+
+  bool m_isAggregated;
+  bool m_isPerApp;
+  bool m_isFinalized;
+  Time m_summaryPeriod;
+  EventId m_summaryEvent;
+  std::map<int64_t, Histograms> m_histograms; ///< AppId (or -1 for per-node) => histograms
 };
 
 } // namespace ndn
@@ -0,0 +1,423 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-l3-dense-rate-tracer.hpp"
+#include "ns3/node.h"
+#include "ns3/simulator.h"
+#include "ns3/log.h"
+#include "ns3/node-list.h"
+#include "ns3/ndnSIM/model/ndn-l3-protocol.hpp"
+
+#include "daemon/table/pit-entry.hpp"
+
+#include <fstream>
+#include <cstdio>
+#include <algorithm>
+#include <list>
+#include <boost/lexical_cast.hpp>
+
+NS_LOG_COMPONENT_DEFINE("ndn.L3DenseRateTracer");
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @brief Tracers sharing one output stream and one periodic output event
+ */
+struct L3DenseRateTracerGroup {
+  shared_ptr<std::ostream> os;
+  std::list<Ptr<L3DenseRateTracer>> tracers;
+  Time period;
+  EventId printEvent;
+  std::string buffer; ///< reused between periods to avoid reallocations
+};
+
+static std::list<shared_ptr<L3DenseRateTracerGroup>> g_groups;
+
+static const double alpha = 0.8;
+
+static const char* const COUNTER_NAMES[L3DenseRateTracer::N_COUNTER_TYPES] = {
+  "InInterests",
+  "OutInterests",
+  "InData",
+  "OutData",
+  "InNacks",
+  "OutNacks",
+  "InSatisfiedInterests",
+  "InTimedOutInterests",
+  "OutSatisfiedInterests",
+  "OutTimedOutInterests"
+};
+
+static void
+PeriodicGroupPrinter(L3DenseRateTracerGroup* group)
+{
+  double time = Simulator::Now().ToDouble(Time::S);
+  double period = group->period.ToDouble(Time::S);
+
+  group->buffer.clear();
+  for (auto& tracer : group->tracers) {
+    tracer->AppendRows(group->buffer, time, period);
+  }
+  group->os->write(group->buffer.data(), group->buffer.size());
+
+  group->printEvent = Simulator::Schedule(group->period, &PeriodicGroupPrinter, group);
+}
+
+static void
+InstallGroup(const NodeContainer& nodes, const std::string& file, Time averagingPeriod,
+             L3DenseRateTracer::Format format)
+{
+  auto group = make_shared<L3DenseRateTracerGroup>();
+  if (file != "-") {
+    std::ios_base::openmode mode = std::ios_base::out | std::ios_base::trunc;
+    if (format == L3DenseRateTracer::BINARY) {
+      mode |= std::ios_base::binary;
+    }
+
+    shared_ptr<std::ofstream> os(new std::ofstream());
+    os->open(file.c_str(), mode);
+
+    if (!os->is_open()) {
+      NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+      return;
+    }
+
+    group->os = os;
+  }
+  else {
+    group->os = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
+  }
+
+  for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
+    NS_LOG_DEBUG("Node: " << (*node)->GetId());
+    group->tracers.push_back(Create<L3DenseRateTracer>(*node, format));
+  }
+
+  if (group->tracers.size() > 0 && format == L3DenseRateTracer::TEXT) {
+    group->tracers.front()->PrintHeader(*group->os);
+    *group->os << "\n";
+  }
+
+  group->period = averagingPeriod;
+  group->printEvent = Simulator::Schedule(group->period, &PeriodicGroupPrinter, group.get());
+
+  g_groups.push_back(group);
+}
+
+void
+L3DenseRateTracer::Destroy()
+{
+  for (auto& group : g_groups) {
+    group->printEvent.Cancel();
+  }
+  g_groups.clear();
+}
+
+void
+L3DenseRateTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/,
+                              Format format /* = TEXT*/)
+{
+  NodeContainer nodes;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    nodes.Add(*node);
+  }
+
+  InstallGroup(nodes, file, averagingPeriod, format);
+}
+
+void
+L3DenseRateTracer::Install(const NodeContainer& nodes, const std::string& file,
+                           Time averagingPeriod /* = Seconds (0.5)*/, Format format /* = TEXT*/)
+{
+  InstallGroup(nodes, file, averagingPeriod, format);
+}
+
+void
+L3DenseRateTracer::Install(Ptr<Node> node, const std::string& file,
+                           Time averagingPeriod /* = Seconds (0.5)*/, Format format /* = TEXT*/)
+{
+  InstallGroup(NodeContainer(node), file, averagingPeriod, format);
+}
+
+L3DenseRateTracer::L3DenseRateTracer(Ptr<Node> node, Format format /* = TEXT*/)
+  : L3Tracer(node)
+  , m_format(format)
+  , m_nodeId(node->GetId())
+  , m_total() // value-initialization zeroes all counters
+  , m_hasTotal(false)
+{
+  m_total.prefix = m_node + "\t-1\tall\t";
+  m_total.faceId = -1;
+}
+
+L3DenseRateTracer::~L3DenseRateTracer()
+{
+}
+
+void
+L3DenseRateTracer::PrintHeader(std::ostream& os) const
+{
+  if (m_format == BINARY) {
+    return;
+  }
+
+  os << "Time"
+     << "\t"
+
+     << "Node"
+     << "\t"
+     << "FaceId"
+     << "\t"
+     << "FaceDescr"
+     << "\t"
+
+     << "Type"
+     << "\t"
+     << "Packets"
+     << "\t"
+     << "Kilobytes"
+     << "\t"
+     << "PacketRaw"
+     << "\t"
+     << "KilobytesRaw";
+}
+
+void
+L3DenseRateTracer::Print(std::ostream& os) const
+{
+  double time = Simulator::Now().ToDouble(Time::S);
+  char timeStr[32];
+  std::snprintf(timeStr, sizeof(timeStr), "%g\t", time);
+
+  std::string buffer;
+  for (uint32_t slot : m_faceSlots) {
+    if (slot != 0) {
+      appendFaceRows(buffer, timeStr, time, m_rows[slot - 1]);
+    }
+  }
+  appendTotalRows(buffer, timeStr, time);
+
+  os.write(buffer.data(), buffer.size());
+}
+
+void
+L3DenseRateTracer::AppendRows(std::string& buffer, double time, double period)
+{
+  char timeStr[32];
+  std::snprintf(timeStr, sizeof(timeStr), "%g\t", time);
+
+  // faces are visited in FaceId order, same as in L3RateTracer
+  for (uint32_t slot : m_faceSlots) {
+    if (slot != 0) {
+      Row& row = m_rows[slot - 1];
+      updateRow(row, period);
+      appendFaceRows(buffer, timeStr, time, row);
+      resetRow(row);
+    }
+  }
+
+  updateRow(m_total, period);
+  appendTotalRows(buffer, timeStr, time);
+  resetRow(m_total);
+}
+
+void
+L3DenseRateTracer::resetRow(Row& row)
+{
+  std::fill_n(row.packets, static_cast<int>(N_COUNTER_TYPES), 0);
+  std::fill_n(row.bytes, static_cast<int>(N_COUNTER_TYPES), 0);
+}
+
+void
+L3DenseRateTracer::updateRow(Row& row, double period)
+{
+  for (int type = 0; type < N_COUNTER_TYPES; ++type) {
+    row.packetRate[type] = /*new value*/ alpha * row.packets[type] / period
+                           + /*old value*/ (1 - alpha) * row.packetRate[type];
+    row.kilobyteRate[type] = /*new value*/ alpha * row.bytes[type] / period / 1024.0
+                             + /*old value*/ (1 - alpha) * row.kilobyteRate[type];
+  }
+}
+
+void
+L3DenseRateTracer::appendFaceRows(std::string& buffer, const char* timeStr, double time,
+                                  const Row& row) const
+{
+  for (int type = 0; type < N_COUNTER_TYPES; ++type) {
+    appendRow(buffer, timeStr, time, row, static_cast<CounterType>(type), COUNTER_NAMES[type]);
+  }
+}
+
+void
+L3DenseRateTracer::appendTotalRows(std::string& buffer, const char* timeStr, double time) const
+{
+  if (!m_hasTotal) {
+    return;
+  }
+
+  appendRow(buffer, timeStr, time, m_total, IN_SATISFIED_INTERESTS, "SatisfiedInterests");
+  appendRow(buffer, timeStr, time, m_total, IN_TIMED_OUT_INTERESTS, "TimedOutInterests");
+}
+
+void
+L3DenseRateTracer::appendRow(std::string& buffer, const char* timeStr, double time,
+                             const Row& row, CounterType type, const char* typeName) const
+{
+  if (m_format == BINARY) {
+    BinaryRecord record;
+    record.time = time;
+    record.node = m_nodeId;
+    record.type = type;
+    record.faceId = row.faceId;
+    record.packets = row.packetRate[type];
+    record.kilobytes = row.kilobyteRate[type];
+    record.packetsRaw = row.packets[type];
+    record.kilobytesRaw = row.bytes[type] / 1024.0;
+
+    buffer.append(reinterpret_cast<const char*>(&record), sizeof(record));
+    return;
+  }
+
+  char values[128];
+  int length = std::snprintf(values, sizeof(values), "\t%g\t%g\t%g\t%g\n",
+                             row.packetRate[type], row.kilobyteRate[type],
+                             static_cast<double>(row.packets[type]), row.bytes[type] / 1024.0);
+
+  buffer.append(timeStr);
+  buffer.append(row.prefix);
+  buffer.append(typeName);
+  buffer.append(values, length);
+}
+
+L3DenseRateTracer::Row&
+L3DenseRateTracer::getRow(const Face& face)
+{
+  nfd::FaceId faceId = face.getId();
+  if (faceId >= m_faceSlots.size()) {
+    m_faceSlots.resize(faceId + 1, 0);
+  }
+
+  uint32_t& slot = m_faceSlots[faceId];
+  if (slot == 0) {
+    m_rows.push_back(Row()); // value-initialization zeroes all counters
+    Row& row = m_rows.back();
+    row.faceId = faceId;
+    row.prefix = m_node + "\t" + boost::lexical_cast<std::string>(faceId) + "\t"
+                 + boost::lexical_cast<std::string>(face.getLocalUri()) + "\t";
+    slot = m_rows.size();
+  }
+
+  return m_rows[slot - 1];
+}
+
+void
+L3DenseRateTracer::OutInterests(const Interest& interest, const Face& face)
+{
+  Row& row = getRow(face);
+  row.packets[OUT_INTERESTS]++;
+  if (interest.hasWire()) {
+    row.bytes[OUT_INTERESTS] += interest.wireEncode().size();
+  }
+}
+
+void
+L3DenseRateTracer::InInterests(const Interest& interest, const Face& face)
+{
+  Row& row = getRow(face);
+  row.packets[IN_INTERESTS]++;
+  if (interest.hasWire()) {
+    row.bytes[IN_INTERESTS] += interest.wireEncode().size();
+  }
+}
+
+void
+L3DenseRateTracer::OutData(const Data& data, const Face& face)
+{
+  Row& row = getRow(face);
+  row.packets[OUT_DATA]++;
+  if (data.hasWire()) {
+    row.bytes[OUT_DATA] += data.wireEncode().size();
+  }
+}
+
+void
+L3DenseRateTracer::InData(const Data& data, const Face& face)
+{
+  Row& row = getRow(face);
+  row.packets[IN_DATA]++;
+  if (data.hasWire()) {
+    row.bytes[IN_DATA] += data.wireEncode().size();
+  }
+}
+
+void
+L3DenseRateTracer::OutNack(const lp::Nack& nack, const Face& face)
+{
+  Row& row = getRow(face);
+  row.packets[OUT_NACKS]++;
+  if (nack.getInterest().hasWire()) {
+    row.bytes[OUT_NACKS] += nack.getInterest().wireEncode().size();
+  }
+}
+
+void
+L3DenseRateTracer::InNack(const lp::Nack& nack, const Face& face)
+{
+  Row& row = getRow(face);
+  row.packets[IN_NACKS]++;
+  if (nack.getInterest().hasWire()) {
+    row.bytes[IN_NACKS] += nack.getInterest().wireEncode().size();
+  }
+}
+
+void
+L3DenseRateTracer::SatisfiedInterests(const nfd::pit::Entry& entry, const Face&, const Data&)
+{
+  m_hasTotal = true;
+  m_total.packets[IN_SATISFIED_INTERESTS]++;
+  // no "size" stats
+
+  for (const auto& in : entry.getInRecords()) {
+    getRow(in.getFace()).packets[IN_SATISFIED_INTERESTS]++;
+  }
+
+  for (const auto& out : entry.getOutRecords()) {
+    getRow(out.getFace()).packets[OUT_SATISFIED_INTERESTS]++;
+  }
+}
+
+void
+L3DenseRateTracer::TimedOutInterests(const nfd::pit::Entry& entry)
+{
+  m_hasTotal = true;
+  m_total.packets[IN_TIMED_OUT_INTERESTS]++;
+  // no "size" stats
+
+  for (const auto& in : entry.getInRecords()) {
+    getRow(in.getFace()).packets[IN_TIMED_OUT_INTERESTS]++;
+  }
+
+  for (const auto& out : entry.getOutRecords()) {
+    getRow(out.getFace()).packets[OUT_TIMED_OUT_INTERESTS]++;
+  }
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,226 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_L3_DENSE_RATE_TRACER_H
+#define NDN_L3_DENSE_RATE_TRACER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ndn-l3-tracer.hpp"
+
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/node-container.h"
+
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-tracers
+ * @brief NDN network-layer rate tracer optimized for large topologies
+ *
+ * Produces the same text output as L3RateTracer, but keeps per-face counters in dense arrays
+ * indexed by FaceId, precomputes row prefixes when the face is first seen, and formats all rows
+ * of all tracers installed by one Install call into a single reusable buffer, which is written
+ * to the output stream once per averaging period.  No memory is allocated in the trace callbacks
+ * once all faces have been seen.
+ *
+ * In binary mode, each row is written as a BinaryRecord (host byte order, no header).
+ */
+class L3DenseRateTracer : public L3Tracer {
+public:
+  enum Format {
+    TEXT,
+    BINARY
+  };
+
+  /**
+   * @brief Counter types, in the order rows are printed for each face
+   */
+  enum CounterType {
+    IN_INTERESTS,
+    OUT_INTERESTS,
+    IN_DATA,
+    OUT_DATA,
+    IN_NACKS,
+    OUT_NACKS,
+    IN_SATISFIED_INTERESTS,
+    IN_TIMED_OUT_INTERESTS,
+    OUT_SATISFIED_INTERESTS,
+    OUT_TIMED_OUT_INTERESTS,
+    N_COUNTER_TYPES
+  };
+
+  /**
+   * @brief Layout of one row in binary output
+   *
+   * Combined node metrics are reported with faceId -1 and type IN_SATISFIED_INTERESTS
+   * (SatisfiedInterests) or IN_TIMED_OUT_INTERESTS (TimedOutInterests)
+   */
+  struct BinaryRecord {
+    double time;
+    uint32_t node;
+    uint32_t type;
+    int64_t faceId;
+    double packets;
+    double kilobytes;
+    double packetsRaw;
+    double kilobytesRaw;
+  };
+
+  /**
+   * @brief Helper method to install tracers on all simulation nodes
+   *
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param averagingPeriod Defines averaging period for the rate calculation,
+   *        as well as how often data will be written into the trace file
+   * @param format Text (same as L3RateTracer) or binary output
+   */
+  static void
+  InstallAll(const std::string& file, Time averagingPeriod = Seconds(0.5), Format format = TEXT);
+
+  /**
+   * @brief Helper method to install tracers on the selected simulation nodes
+   *
+   * @param nodes Nodes on which to install tracer
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param averagingPeriod How often data will be written into the trace file
+   * @param format Text (same as L3RateTracer) or binary output
+   */
+  static void
+  Install(const NodeContainer& nodes, const std::string& file, Time averagingPeriod = Seconds(0.5),
+          Format format = TEXT);
+
+  /**
+   * @brief Helper method to install tracer on a specific simulation node
+   *
+   * @param node Node on which to install tracer
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param averagingPeriod How often data will be written into the trace file
+   * @param format Text (same as L3RateTracer) or binary output
+   */
+  static void
+  Install(Ptr<Node> node, const std::string& file, Time averagingPeriod = Seconds(0.5),
+          Format format = TEXT);
+
+  /**
+   * @brief Explicit request to remove all statically created tracers
+   *
+   * Output streams are flushed and closed when tracers are removed
+   */
+  static void
+  Destroy();
+
+  /**
+   * @brief Trace constructor that attaches to the node using node pointer
+   * @param node    pointer to the node
+   * @param format  output format
+   */
+  L3DenseRateTracer(Ptr<Node> node, Format format = TEXT);
+
+  virtual
+  ~L3DenseRateTracer();
+
+  // from L3Tracer
+  virtual void
+  PrintHeader(std::ostream& os) const;
+
+  virtual void
+  Print(std::ostream& os) const;
+
+  /**
+   * @brief Update rate estimations for the last period, append rows to @p buffer, and reset
+   *        counters
+   */
+  void
+  AppendRows(std::string& buffer, double time, double period);
+
+protected:
+  // from L3Tracer
+  virtual void
+  OutInterests(const Interest& interest, const Face& face);
+
+  virtual void
+  InInterests(const Interest& interest, const Face& face);
+
+  virtual void
+  OutData(const Data& data, const Face& face);
+
+  virtual void
+  InData(const Data& data, const Face& face);
+
+  virtual void
+  OutNack(const lp::Nack& nack, const Face& face);
+
+  virtual void
+  InNack(const lp::Nack& nack, const Face& face);
+
+  virtual void
+  SatisfiedInterests(const nfd::pit::Entry&, const Face&, const Data&);
+
+  virtual void
+  TimedOutInterests(const nfd::pit::Entry&);
+
+private:
+  struct Row {
+    std::string prefix; ///< precomputed "Node\tFaceId\tFaceDescr\t"
+    int64_t faceId;
+
+    uint64_t packets[N_COUNTER_TYPES];
+    uint64_t bytes[N_COUNTER_TYPES];
+    double packetRate[N_COUNTER_TYPES];
+    double kilobyteRate[N_COUNTER_TYPES];
+  };
+
+  Row&
+  getRow(const Face& face);
+
+  void
+  appendRow(std::string& buffer, const char* timeStr, double time, const Row& row,
+            CounterType type, const char* typeName) const;
+
+  void
+  appendFaceRows(std::string& buffer, const char* timeStr, double time, const Row& row) const;
+
+  void
+  appendTotalRows(std::string& buffer, const char* timeStr, double time) const;
+
+  static void
+  updateRow(Row& row, double period);
+
+  static void
+  resetRow(Row& row);
+
+private:
+  Format m_format;
+  uint32_t m_nodeId;
+
+  std::vector<uint32_t> m_faceSlots; ///< FaceId => index in m_rows + 1 (0 if face not seen)
+  std::vector<Row> m_rows;
+
+  Row m_total; ///< combined metrics of the node (FaceId -1)
+  bool m_hasTotal;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_L3_DENSE_RATE_TRACER_H
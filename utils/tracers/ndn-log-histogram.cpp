@@ -0,0 +1,131 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-log-histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ns3 {
+namespace ndn {
+
+static const uint64_t SUB_BUCKET_COUNT = 1 << LogHistogram::SUB_BUCKET_BITS;
+static const uint64_t SUB_BUCKET_HALF_COUNT = SUB_BUCKET_COUNT / 2;
+
+LogHistogram::LogHistogram()
+  : m_count(0)
+  , m_sum(0)
+  , m_min(std::numeric_limits<uint64_t>::max())
+  , m_max(0)
+{
+}
+
+size_t
+LogHistogram::getIndex(uint64_t value)
+{
+  if (value < SUB_BUCKET_COUNT) {
+    return value;
+  }
+
+  int msb = 63 - __builtin_clzll(value);
+  int shift = msb - SUB_BUCKET_BITS + 1;
+  // (value >> shift) is in [SUB_BUCKET_HALF_COUNT, SUB_BUCKET_COUNT)
+  return SUB_BUCKET_COUNT + (shift - 1) * SUB_BUCKET_HALF_COUNT
+         + ((value >> shift) - SUB_BUCKET_HALF_COUNT);
+}
+
+uint64_t
+LogHistogram::getValue(size_t index)
+{
+  if (index < SUB_BUCKET_COUNT) {
+    return index;
+  }
+
+  size_t offset = index - SUB_BUCKET_COUNT;
+  int shift = offset / SUB_BUCKET_HALF_COUNT + 1;
+  uint64_t lower = (offset % SUB_BUCKET_HALF_COUNT + SUB_BUCKET_HALF_COUNT) << shift;
+  uint64_t width = uint64_t(1) << shift;
+  return lower + ((width - 1) >> 1);
+}
+
+void
+LogHistogram::record(uint64_t value)
+{
+  size_t index = getIndex(value);
+  if (index >= m_counts.size()) {
+    m_counts.resize(index + 1, 0);
+  }
+
+  m_counts[index]++;
+  m_count++;
+  m_sum += value;
+  m_min = std::min(m_min, value);
+  m_max = std::max(m_max, value);
+}
+
+void
+LogHistogram::merge(const LogHistogram& other)
+{
+  if (other.m_counts.size() > m_counts.size()) {
+    m_counts.resize(other.m_counts.size(), 0);
+  }
+
+  for (size_t i = 0; i < other.m_counts.size(); ++i) {
+    m_counts[i] += other.m_counts[i];
+  }
+  m_count += other.m_count;
+  m_sum += other.m_sum;
+  m_min = std::min(m_min, other.m_min);
+  m_max = std::max(m_max, other.m_max);
+}
+
+void
+LogHistogram::reset()
+{
+  // keep allocated buckets, they are likely to be needed again
+  std::fill(m_counts.begin(), m_counts.end(), 0);
+  m_count = 0;
+  m_sum = 0;
+  m_min = std::numeric_limits<uint64_t>::max();
+  m_max = 0;
+}
+
+uint64_t
+LogHistogram::getValueAtPercentile(double percentile) const
+{
+  if (m_count == 0) {
+    return 0;
+  }
+
+  uint64_t target = static_cast<uint64_t>(std::ceil(percentile / 100.0 * m_count));
+  target = std::max<uint64_t>(1, std::min(target, m_count));
+
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < m_counts.size(); ++i) {
+    cumulative += m_counts[i];
+    if (cumulative >= target) {
+      return std::max(m_min, std::min(getValue(i), m_max));
+    }
+  }
+  return m_max;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,114 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_LOG_HISTOGRAM_H
+#define NDN_LOG_HISTOGRAM_H
+
+#include <cstdint>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-tracers
+ * @brief HDR-style histogram with logarithmic buckets and linear sub-buckets
+ *
+ * Values below 2^SUB_BUCKET_BITS are recorded exactly.  Larger values are recorded with
+ * relative error of at most 2^-(SUB_BUCKET_BITS-1) (~1.6%).  Memory grows only up to the
+ * bucket of the largest recorded value (about 10 KiB for microsecond delays of up to 10 s),
+ * and recording a value is O(1).
+ */
+class LogHistogram {
+public:
+  static const int SUB_BUCKET_BITS = 7;
+
+  LogHistogram();
+
+  /**
+   * @brief Record one sample
+   */
+  void
+  record(uint64_t value);
+
+  /**
+   * @brief Add all samples of another histogram
+   */
+  void
+  merge(const LogHistogram& other);
+
+  /**
+   * @brief Remove all samples
+   */
+  void
+  reset();
+
+  uint64_t
+  getCount() const
+  {
+    return m_count;
+  }
+
+  uint64_t
+  getMin() const
+  {
+    return m_count == 0 ? 0 : m_min;
+  }
+
+  uint64_t
+  getMax() const
+  {
+    return m_max;
+  }
+
+  double
+  getMean() const
+  {
+    return m_count == 0 ? 0 : static_cast<double>(m_sum) / m_count;
+  }
+
+  /**
+   * @brief Get (approximate) value below which @p percentile percent of samples fall
+   * @param percentile value in [0, 100]
+   */
+  uint64_t
+  getValueAtPercentile(double percentile) const;
+
+private:
+  static size_t
+  getIndex(uint64_t value);
+
+  /**
+   * @brief Representative value of all values in the bucket (middle of the bucket's range)
+   */
+  static uint64_t
+  getValue(size_t index);
+
+private:
+  std::vector<uint64_t> m_counts;
+  uint64_t m_count;
+  uint64_t m_sum;
+  uint64_t m_min;
+  uint64_t m_max;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_LOG_HISTOGRAM_H
@@ -0,0 +1,164 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-network-tracer.hpp"
+#include "ndn-trace-writer.hpp"
+
+#include "ns3/node.h"
+#include "ns3/simulator.h"
+#include "ns3/log.h"
+#include "ns3/node-list.h"
+#include "ns3/ndnSIM/model/ndn-l3-protocol.hpp"
+#include "ns3/ndnSIM/model/cs/ndn-content-store.hpp"
+
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
+#include <list>
+
+NS_LOG_COMPONENT_DEFINE("ndn.NetworkTracer");
+
+namespace ns3 {
+namespace ndn {
+
+static std::list<Ptr<NetworkTracer>> g_tracers;
+
+template<class Record>
+static void
+appendRecord(std::string& block, const Record& record)
+{
+  block.append(reinterpret_cast<const char*>(&record), sizeof(record));
+}
+
+void
+NetworkTracer::Destroy()
+{
+  // destruction of the last reference to TraceWriter flushes all pending blocks
+  g_tracers.clear();
+}
+
+void
+NetworkTracer::InstallAll(const std::string& file, Time period /* = Seconds(0.5)*/,
+                          bool shouldCompress /* = false*/, bool useBackgroundThread /* = true*/)
+{
+  NodeContainer nodes;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    nodes.Add(*node);
+  }
+
+  Install(nodes, file, period, shouldCompress, useBackgroundThread);
+}
+
+void
+NetworkTracer::Install(const NodeContainer& nodes, const std::string& file,
+                       Time period /* = Seconds(0.5)*/, bool shouldCompress /* = false*/,
+                       bool useBackgroundThread /* = true*/)
+{
+  auto writer = make_shared<TraceWriter>(file, shouldCompress, useBackgroundThread);
+  if (!writer->isOpen()) {
+    return;
+  }
+
+  g_tracers.push_back(Create<NetworkTracer>(nodes, writer, period));
+}
+
+NetworkTracer::NetworkTracer(const NodeContainer& nodes, shared_ptr<TraceWriter> writer,
+                             Time period)
+  : m_nodes(nodes)
+  , m_writer(writer)
+  , m_period(period)
+{
+  m_snapshotEvent = Simulator::Schedule(m_period, &NetworkTracer::PeriodicSnapshot, this);
+}
+
+NetworkTracer::~NetworkTracer()
+{
+  m_snapshotEvent.Cancel();
+}
+
+void
+NetworkTracer::PeriodicSnapshot()
+{
+  std::string block = m_writer->getBuffer();
+  Snapshot(block);
+  m_writer->write(std::move(block));
+
+  m_snapshotEvent = Simulator::Schedule(m_period, &NetworkTracer::PeriodicSnapshot, this);
+}
+
+void
+NetworkTracer::Snapshot(std::string& block) const
+{
+  BlockHeader header;
+  header.magic = MAGIC;
+  header.nNodes = 0;
+  header.time = Simulator::Now().ToDouble(Time::S);
+  appendRecord(block, header);
+
+  for (NodeContainer::Iterator node = m_nodes.Begin(); node != m_nodes.End(); node++) {
+    Ptr<L3Protocol> ndn = (*node)->GetObject<L3Protocol>();
+    if (ndn == nullptr) {
+      continue;
+    }
+    nfd::Forwarder& forwarder = *ndn->getForwarder();
+
+    NodeRecord nodeRecord;
+    nodeRecord.node = (*node)->GetId();
+    nodeRecord.nFaces = 0;
+    nodeRecord.nPitEntries = forwarder.getPit().size();
+
+    Ptr<ContentStore> cs = (*node)->GetObject<ContentStore>();
+    if (cs != nullptr) {
+      nodeRecord.nCsEntries = cs->GetSize();
+    }
+    else {
+      nodeRecord.nCsEntries = forwarder.getCs().size();
+    }
+
+    size_t nodeRecordOffset = block.size();
+    appendRecord(block, nodeRecord);
+
+    for (const Face& face : forwarder.getFaceTable()) {
+      const nfd::face::FaceCounters& counters = face.getCounters();
+
+      FaceRecord faceRecord;
+      faceRecord.faceId = face.getId();
+      faceRecord.nInInterests = counters.nInInterests;
+      faceRecord.nOutInterests = counters.nOutInterests;
+      faceRecord.nInData = counters.nInData;
+      faceRecord.nOutData = counters.nOutData;
+      faceRecord.nInNacks = counters.nInNacks;
+      faceRecord.nOutNacks = counters.nOutNacks;
+      faceRecord.nInBytes = counters.nInBytes;
+      faceRecord.nOutBytes = counters.nOutBytes;
+      appendRecord(block, faceRecord);
+
+      nodeRecord.nFaces++;
+    }
+
+    // update number of faces in the already written node record
+    block.replace(nodeRecordOffset, sizeof(nodeRecord),
+                  reinterpret_cast<const char*>(&nodeRecord), sizeof(nodeRecord));
+    header.nNodes++;
+  }
+
+  block.replace(0, sizeof(header), reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+} // namespace ndn
+} // namespace ns3
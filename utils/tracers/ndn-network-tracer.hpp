@@ -0,0 +1,141 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_NETWORK_TRACER_H
+#define NDN_NETWORK_TRACER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/node-container.h"
+
+namespace ns3 {
+namespace ndn {
+
+class TraceWriter;
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Network-wide tracer that periodically snapshots counters of all nodes into one file
+ *
+ * Unlike per-node tracers, NetworkTracer does not connect to any per-packet trace sources and
+ * uses a single periodic event regardless of the number of nodes.  On each period, cumulative
+ * face counters and table sizes of every traced node are copied into one contiguous binary
+ * block, which is then written by TraceWriter (optionally gzip-compressed, optionally in a
+ * background thread).
+ *
+ * Each block has the following layout (host byte order):
+ *
+ *     BlockHeader
+ *     NodeRecord (node 1)
+ *       FaceRecord x NodeRecord::nFaces
+ *     NodeRecord (node 2)
+ *       FaceRecord x NodeRecord::nFaces
+ *     ...
+ *
+ * Counters are cumulative since the beginning of the simulation; rates are obtained in
+ * post-processing as differences between consecutive blocks.
+ */
+class NetworkTracer : public SimpleRefCount<NetworkTracer> {
+public:
+  static const uint32_t MAGIC = 0x4e444e54; ///< "NDNT"
+
+  struct BlockHeader {
+    uint32_t magic;
+    uint32_t nNodes;
+    double time;
+  };
+
+  struct NodeRecord {
+    uint32_t node;
+    uint32_t nFaces;
+    uint64_t nPitEntries;
+    uint64_t nCsEntries;
+  };
+
+  struct FaceRecord {
+    uint64_t faceId;
+    uint64_t nInInterests;
+    uint64_t nOutInterests;
+    uint64_t nInData;
+    uint64_t nOutData;
+    uint64_t nInNacks;
+    uint64_t nOutNacks;
+    uint64_t nInBytes;
+    uint64_t nOutBytes;
+  };
+
+  /**
+   * @brief Helper method to install network-wide tracer on all simulation nodes
+   *
+   * @param file File to which traces will be written
+   * @param period How often snapshots will be taken
+   * @param shouldCompress Compress the output with gzip
+   * @param useBackgroundThread Compress and write snapshots in a separate thread
+   */
+  static void
+  InstallAll(const std::string& file, Time period = Seconds(0.5), bool shouldCompress = false,
+             bool useBackgroundThread = true);
+
+  /**
+   * @brief Helper method to install network-wide tracer on the selected simulation nodes
+   *
+   * @param nodes Nodes to include into snapshots
+   * @param file File to which traces will be written
+   * @param period How often snapshots will be taken
+   * @param shouldCompress Compress the output with gzip
+   * @param useBackgroundThread Compress and write snapshots in a separate thread
+   */
+  static void
+  Install(const NodeContainer& nodes, const std::string& file, Time period = Seconds(0.5),
+          bool shouldCompress = false, bool useBackgroundThread = true);
+
+  /**
+   * @brief Explicit request to remove all statically created tracers
+   *
+   * All pending snapshots are written out before this method returns
+   */
+  static void
+  Destroy();
+
+  NetworkTracer(const NodeContainer& nodes, shared_ptr<TraceWriter> writer, Time period);
+
+  ~NetworkTracer();
+
+private:
+  void
+  PeriodicSnapshot();
+
+  void
+  Snapshot(std::string& block) const;
+
+private:
+  NodeContainer m_nodes;
+  shared_ptr<TraceWriter> m_writer;
+  Time m_period;
+  EventId m_snapshotEvent;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_NETWORK_TRACER_H
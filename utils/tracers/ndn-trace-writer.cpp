@@ -0,0 +1,131 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-trace-writer.hpp"
+
+#include "ns3/log.h"
+
+#include <boost/iostreams/filter/gzip.hpp>
+
+NS_LOG_COMPONENT_DEFINE("ndn.TraceWriter");
+
+namespace ns3 {
+namespace ndn {
+
+TraceWriter::TraceWriter(const std::string& file, bool shouldCompress, bool useBackgroundThread)
+  : m_useBackgroundThread(useBackgroundThread)
+  , m_isStopping(false)
+{
+  m_file.open(file.c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+  if (!m_file.is_open()) {
+    NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+    return;
+  }
+
+  if (shouldCompress) {
+    m_os.push(boost::iostreams::gzip_compressor());
+  }
+  m_os.push(m_file);
+
+  if (m_useBackgroundThread) {
+    m_thread = std::thread(&TraceWriter::run, this);
+  }
+}
+
+TraceWriter::~TraceWriter()
+{
+  if (m_thread.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_isStopping = true;
+    }
+    m_cv.notify_one();
+    m_thread.join();
+  }
+
+  // flushes compressor (if any) and the file
+  m_os.reset();
+}
+
+bool
+TraceWriter::isOpen() const
+{
+  return m_file.is_open();
+}
+
+std::string
+TraceWriter::getBuffer()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_freeBuffers.empty()) {
+    return std::string();
+  }
+
+  std::string buffer = std::move(m_freeBuffers.front());
+  m_freeBuffers.pop_front();
+  buffer.clear();
+  return buffer;
+}
+
+void
+TraceWriter::write(std::string&& block)
+{
+  if (!m_useBackgroundThread) {
+    writeBlock(block);
+    m_freeBuffers.push_back(std::move(block));
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queue.push_back(std::move(block));
+  }
+  m_cv.notify_one();
+}
+
+void
+TraceWriter::writeBlock(const std::string& block)
+{
+  m_os.write(block.data(), block.size());
+}
+
+void
+TraceWriter::run()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true) {
+    m_cv.wait(lock, [this] { return m_isStopping || !m_queue.empty(); });
+    if (m_queue.empty()) {
+      // stopping and nothing left to write
+      break;
+    }
+
+    std::string block = std::move(m_queue.front());
+    m_queue.pop_front();
+
+    lock.unlock();
+    writeBlock(block);
+    lock.lock();
+
+    m_freeBuffers.push_back(std::move(block));
+  }
+}
+
+} // namespace ndn
+} // namespace ns3
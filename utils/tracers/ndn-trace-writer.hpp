@@ -0,0 +1,97 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_TRACE_WRITER_H
+#define NDN_TRACE_WRITER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Writer of trace blocks into a file, optionally compressed and in a background thread
+ *
+ * Tracers fill a block obtained from getBuffer() and hand it back using write().  In background
+ * mode, compression and file I/O are done by a separate thread, so the simulation thread only
+ * pays for filling the block.  Buffers are recycled, so no memory is allocated in steady state.
+ */
+class TraceWriter : boost::noncopyable {
+public:
+  /**
+   * @param file File to which blocks will be written
+   * @param shouldCompress Compress the output with gzip
+   * @param useBackgroundThread Compress and write blocks in a separate thread
+   */
+  TraceWriter(const std::string& file, bool shouldCompress, bool useBackgroundThread);
+
+  /**
+   * @brief Write out all pending blocks and close the file
+   */
+  ~TraceWriter();
+
+  bool
+  isOpen() const;
+
+  /**
+   * @brief Get an empty buffer to be filled with the next block
+   */
+  std::string
+  getBuffer();
+
+  /**
+   * @brief Write (or enqueue for writing) the block
+   */
+  void
+  write(std::string&& block);
+
+private:
+  void
+  writeBlock(const std::string& block);
+
+  void
+  run();
+
+private:
+  std::ofstream m_file;
+  boost::iostreams::filtering_ostream m_os;
+
+  bool m_useBackgroundThread;
+  std::thread m_thread;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::deque<std::string> m_queue;
+  std::deque<std::string> m_freeBuffers;
+  bool m_isStopping;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_TRACE_WRITER_H